@@ -219,6 +219,18 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 				index++;
 				String str;
 				while (true) {
+					// Append runs of unescaped characters at once rather than one by one.
+					const int run_start = index;
+					while (p_str[index] != 0 && p_str[index] != '"' && p_str[index] != '\\') {
+						if (p_str[index] == '\n') {
+							line++;
+						}
+						index++;
+					}
+					if (index > run_start) {
+						str.append_utf32(Span(&p_str[run_start], index - run_start));
+					}
+
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated string";
 						return ERR_PARSE_ERROR;
@@ -341,14 +353,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						}
 
 						str += res;
-
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+						index++;
 					}
-					index++;
 				}
 
 				r_token.type = TK_STRING;
@@ -372,15 +378,13 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 					return OK;
 
 				} else if (is_ascii_alphabet_char(p_str[index])) {
-					String id;
-
+					const int id_start = index;
 					while (is_ascii_alphabet_char(p_str[index])) {
-						id += p_str[index];
 						index++;
 					}
 
 					r_token.type = TK_IDENTIFIER;
-					r_token.value = id;
+					r_token.value = String::utf32(Span(&p_str[id_start], index - id_start));
 					return OK;
 				} else {
 					r_err_str = "Unexpected character";
@@ -928,10 +928,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -958,9 +955,13 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				//const int *rbuf = (const int *)buf;
 				data.resize(count);
 				int32_t *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < count; i++) {
 					w[i] = decode_uint32(&buf[i * 4]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(int32_t));
+#endif
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -982,9 +983,13 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				//const int *rbuf = (const int *)buf;
 				data.resize(count);
 				int64_t *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int64_t i = 0; i < count; i++) {
 					w[i] = decode_uint64(&buf[i * 8]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(int64_t));
+#endif
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -1006,9 +1011,13 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				//const float *rbuf = (const float *)buf;
 				data.resize(count);
 				float *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < count; i++) {
 					w[i] = decode_float(&buf[i * 4]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(float));
+#endif
 			}
 			r_variant = data;
 
@@ -1030,9 +1039,13 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			if (count) {
 				data.resize(count);
 				double *w = data.ptrw();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int64_t i = 0; i < count; i++) {
 					w[i] = decode_double(&buf[i * 8]);
 				}
+#else
+				memcpy(w, buf, count * sizeof(double));
+#endif
 			}
 			r_variant = data;
 
@@ -1931,9 +1944,15 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const int32_t *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int32_t i = 0; i < datalen; i++) {
 					encode_uint32(r[i], &buf[i * datasize]);
 				}
+#else
+				if (r) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1948,9 +1967,15 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const int64_t *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int64_t i = 0; i < datalen; i++) {
 					encode_uint64(r[i], &buf[i * datasize]);
 				}
+#else
+				if (r) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1965,9 +1990,15 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const float *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < datalen; i++) {
 					encode_float(r[i], &buf[i * datasize]);
 				}
+#else
+				if (r) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1982,9 +2013,15 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				encode_uint32(datalen, buf);
 				buf += 4;
 				const double *r = data.ptr();
+#ifdef BIG_ENDIAN_ENABLED
 				for (int i = 0; i < datalen; i++) {
 					encode_double(r[i], &buf[i * datasize]);
 				}
+#else
+				if (r) {
+					memcpy(buf, r, datalen * datasize);
+				}
+#endif
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -153,6 +153,8 @@ public:
 
 	virtual Error import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) = 0;
 	virtual bool can_import_threaded() const { return false; }
+	// Whether the output only depends on the source file and import options, so it can be restored from the shared import cache.
+	virtual bool can_use_shared_import_cache(const HashMap<StringName, Variant> &p_options) const { return false; }
 	virtual void import_threaded_begin() {}
 	virtual void import_threaded_end() {}
 
@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
 
 #include <cstdio>
 
@@ -206,6 +207,33 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	return OK;
 }
 
+CallQueue *CallQueue::_get_low_priority_queue() {
+	LOCK_MUTEX;
+	if (unlikely(!low_priority_queue)) {
+		// Shares the (thread safe) page allocator and limits of this queue.
+		low_priority_queue = memnew(CallQueue(allocator, max_pages, error_text));
+	}
+	CallQueue *queue = low_priority_queue;
+	UNLOCK_MUTEX;
+	return queue;
+}
+
+Error CallQueue::push_low_priority_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return _get_low_priority_queue()->push_callablep(p_callable, p_args, p_argcount, p_show_error);
+}
+
+Error CallQueue::push_low_priority_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	return _get_low_priority_queue()->push_set(p_id, p_prop, p_value);
+}
+
+void CallQueue::set_low_priority_budget_usec(uint64_t p_usec) {
+	low_priority_budget_usec = p_usec;
+}
+
+uint64_t CallQueue::get_low_priority_budget_usec() const {
+	return low_priority_budget_usec;
+}
+
 void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error) {
 	const Variant **argptrs = nullptr;
 	if (p_argcount) {
@@ -224,6 +252,32 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 }
 
 Error CallQueue::flush() {
+	Error err = _flush(0);
+	if (err != OK) {
+		return err;
+	}
+
+	LOCK_MUTEX;
+	CallQueue *low_priority = low_priority_queue;
+	UNLOCK_MUTEX;
+
+	if (low_priority) {
+		// May be busy if a low priority call flushes this queue, that's fine.
+		low_priority->_flush(low_priority_budget_usec);
+	}
+	return OK;
+}
+
+void CallQueue::_reverse_pages(uint32_t p_from, uint32_t p_to) {
+	while (p_from + 1 < p_to) {
+		p_to--;
+		SWAP(pages[p_from], pages[p_to]);
+		SWAP(page_bytes[p_from], page_bytes[p_to]);
+		p_from++;
+	}
+}
+
+Error CallQueue::_flush(uint64_t p_budget_usec) {
 	LOCK_MUTEX;
 
 	if (pages.is_empty()) {
@@ -239,8 +293,10 @@ Error CallQueue::flush() {
 
 	flushing = true;
 
+	const uint64_t begin_usec = p_budget_usec ? OS::get_singleton()->get_ticks_usec() : 0;
+
 	uint32_t i = 0;
-	uint32_t offset = 0;
+	uint32_t offset = read_offset;
 
 	while (i < pages_used && offset < page_bytes[i]) {
 		Page *page = pages[i];
@@ -295,10 +351,31 @@ Error CallQueue::flush() {
 			i++;
 			offset = 0;
 		}
+
+		if (p_budget_usec && i < pages_used && offset < page_bytes[i] && OS::get_singleton()->get_ticks_usec() - begin_usec >= p_budget_usec) {
+			// Out of time, keep the rest for the next flush.
+			// Fully processed pages are moved behind the ones still in use, to be reused.
+			if (i > 0) {
+				for (uint32_t j = 0; j < i; j++) {
+					page_bytes[j] = 0;
+				}
+				// Rotate in place, reversing the consumed pages, the others, then everything.
+				_reverse_pages(0, i);
+				_reverse_pages(i, pages.size());
+				_reverse_pages(0, pages.size());
+				pages_used -= i;
+			}
+			read_offset = offset;
+
+			flushing = false;
+			UNLOCK_MUTEX;
+			return OK;
+		}
 	}
 
 	page_bytes[0] = 0;
 	pages_used = 1;
+	read_offset = 0;
 
 	flushing = false;
 	UNLOCK_MUTEX;
@@ -314,7 +391,7 @@ void CallQueue::clear() {
 	}
 
 	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
+		uint32_t offset = i == 0 ? read_offset : 0;
 		while (offset < page_bytes[i]) {
 			Page *page = pages[i];
 
@@ -342,8 +419,14 @@ void CallQueue::clear() {
 
 	pages_used = 1;
 	page_bytes[0] = 0;
+	read_offset = 0;
 
+	CallQueue *low_priority = low_priority_queue;
 	UNLOCK_MUTEX;
+
+	if (low_priority) {
+		low_priority->clear();
+	}
 }
 
 void CallQueue::statistics() {
@@ -354,7 +437,7 @@ void CallQueue::statistics() {
 	int null_count = 0;
 
 	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
+		uint32_t offset = i == 0 ? read_offset : 0;
 		while (offset < page_bytes[i]) {
 			Page *page = pages[i];
 
@@ -446,10 +529,13 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
+	if (low_priority_queue && low_priority_queue->has_messages()) {
+		return true;
+	}
 	if (pages_used == 0) {
 		return false;
 	}
-	if (pages_used == 1 && page_bytes[0] == 0) {
+	if (pages_used == 1 && page_bytes[0] == read_offset) {
 		return false;
 	}
 
@@ -457,7 +543,11 @@ bool CallQueue::has_messages() const {
 }
 
 int CallQueue::get_max_buffer_usage() const {
-	return pages.size() * PAGE_SIZE_BYTES;
+	int usage = pages.size() * PAGE_SIZE_BYTES;
+	if (low_priority_queue) {
+		usage += low_priority_queue->get_max_buffer_usage();
+	}
+	return usage;
 }
 
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
@@ -474,6 +564,9 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 
 CallQueue::~CallQueue() {
 	clear();
+	if (low_priority_queue) {
+		memdelete(low_priority_queue);
+	}
 	// Let go of pages.
 	for (uint32_t i = 0; i < pages.size(); i++) {
 		allocator->free(pages[i]);
@@ -509,6 +602,7 @@ MessageQueue::MessageQueue() :
 				"Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_mb' in project settings.") {
 	ERR_FAIL_COND_MSG(main_singleton != nullptr, "A MessageQueue singleton already exists.");
 	main_singleton = this;
+	set_low_priority_budget_usec(GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/limits/message_queue/low_priority_budget_usec", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), 0));
 }
 
 MessageQueue::~MessageQueue() {
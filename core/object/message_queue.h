@@ -74,8 +74,14 @@ private:
 	LocalVector<uint32_t> page_bytes;
 	uint32_t max_pages = 0;
 	uint32_t pages_used = 0;
+	uint32_t read_offset = 0; // Start of the pending messages in the first page, if a budgeted flush stopped early.
 	bool flushing = false;
 
+	// Low priority messages are queued separately and flushed after the regular ones,
+	// for at most low_priority_budget_usec per flush (0 means no limit).
+	CallQueue *low_priority_queue = nullptr;
+	uint64_t low_priority_budget_usec = 0;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -100,6 +106,9 @@ private:
 	void _add_page();
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
+	CallQueue *_get_low_priority_queue();
+	void _reverse_pages(uint32_t p_from, uint32_t p_to);
+	Error _flush(uint64_t p_budget_usec);
 
 	String error_text;
 
@@ -143,6 +152,24 @@ public:
 	Error push_notification(Object *p_object, int p_notification);
 	Error push_set(Object *p_object, const StringName &p_prop, const Variant &p_value);
 
+	// Low priority messages may be delayed to later flushes if the low priority budget runs out.
+	// Their relative order is preserved, but not their order relative to regular messages.
+	Error push_low_priority_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
+	Error push_low_priority_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value);
+
+	template <typename... VarArgs>
+	Error push_low_priority_callable(const Callable &p_callable, VarArgs... p_args) {
+		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
+		const Variant *argptrs[sizeof...(p_args) + 1];
+		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
+			argptrs[i] = &args[i];
+		}
+		return push_low_priority_callablep(p_callable, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+	}
+
+	void set_low_priority_budget_usec(uint64_t p_usec);
+	uint64_t get_low_priority_budget_usec() const;
+
 	Error flush();
 	void clear();
 	void statistics();
@@ -1817,6 +1817,7 @@ void Object::_bind_methods() {
 	}
 
 	ClassDB::bind_method(D_METHOD("set_deferred", "property", "value"), &Object::set_deferred);
+	ClassDB::bind_method(D_METHOD("set_deferred_low_priority", "property", "value"), &Object::set_deferred_low_priority);
 
 	ClassDB::bind_method(D_METHOD("callv", "method", "arg_array"), &Object::callv);
 
@@ -1931,6 +1932,10 @@ void Object::set_deferred(const StringName &p_property, const Variant &p_value)
 	MessageQueue::get_singleton()->push_set(this, p_property, p_value);
 }
 
+void Object::set_deferred_low_priority(const StringName &p_property, const Variant &p_value) {
+	MessageQueue::get_singleton()->push_low_priority_set(get_instance_id(), p_property, p_value);
+}
+
 void Object::set_block_signals(bool p_block) {
 	_block_signals = p_block;
 }
@@ -2335,15 +2340,22 @@ void postinitialize_handler(Object *p_object) {
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
-	spin_lock.lock();
+	for (ObjectShard &shard : shards) {
+		shard.spin_lock.lock();
+	}
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
-			count--;
+	for (uint32_t i = 0, count = chunk_count.load(std::memory_order_acquire); i < count; i++) {
+		ObjectSlot *chunk = object_chunks[i].load(std::memory_order_acquire);
+		for (uint32_t j = 0; j < OBJECTDB_CHUNK_SIZE; j++) {
+			if (chunk[j].validator.load(std::memory_order_relaxed)) {
+				p_func(chunk[j].object.load(std::memory_order_relaxed));
+			}
 		}
 	}
-	spin_lock.unlock();
+
+	for (ObjectShard &shard : shards) {
+		shard.spin_lock.unlock();
+	}
 }
 
 #ifdef TOOLS_ENABLED
@@ -2365,7 +2377,7 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 				}
 				r_options->push_back(E.name.quote());
 			}
-		} else if (pf == "set" || pf == "set_deferred" || pf == "get") {
+		} else if (pf == "set" || pf == "set_deferred" || pf == "set_deferred_low_priority" || pf == "get") {
 			List<PropertyInfo> properties;
 			get_property_list(&properties);
 			for (const PropertyInfo &E : properties) {
@@ -2392,46 +2404,72 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 }
 #endif
 
-SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::object_chunks[OBJECTDB_CHUNK_MAX_COUNT] = {};
+uint8_t ObjectDB::chunk_shards[OBJECTDB_CHUNK_MAX_COUNT] = {};
+std::atomic<uint32_t> ObjectDB::chunk_count = { 0 };
+ObjectDB::ObjectShard ObjectDB::shards[OBJECTDB_SHARD_COUNT];
+
+uint32_t ObjectDB::_get_thread_shard() {
+	static std::atomic<uint32_t> next_shard = { 0 };
+	static thread_local uint32_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % OBJECTDB_SHARD_COUNT;
+	return shard;
+}
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	uint32_t count = 0;
+	for (const ObjectShard &shard : shards) {
+		count += shard.slot_count.load(std::memory_order_relaxed);
+	}
+	return count;
 }
 
 ObjectID ObjectDB::add_instance(Object *p_object) {
-	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+	const uint32_t shard_index = _get_thread_shard();
+	ObjectShard &shard = shards[shard_index];
+
+	shard.spin_lock.lock();
+	if (unlikely(shard.free_slots.is_empty())) {
+		uint32_t chunk_index = chunk_count.load(std::memory_order_relaxed);
+		do {
+			CRASH_COND(chunk_index == OBJECTDB_CHUNK_MAX_COUNT);
+		} while (!chunk_count.compare_exchange_weak(chunk_index, chunk_index + 1, std::memory_order_acq_rel));
+
+		ObjectSlot *chunk = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_CHUNK_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_CHUNK_SIZE; i++) {
+			memnew_placement(&chunk[i].validator, std::atomic<uint64_t>(0));
+			memnew_placement(&chunk[i].object, std::atomic<Object *>(nullptr));
+		}
+		chunk_shards[chunk_index] = shard_index;
+		object_chunks[chunk_index].store(chunk, std::memory_order_release);
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		// Pushed in reverse, so slots are handed out in ascending order.
+		shard.free_slots.reserve(OBJECTDB_CHUNK_SIZE);
+		for (uint32_t i = OBJECTDB_CHUNK_SIZE; i > 0; i--) {
+			shard.free_slots.push_back((chunk_index << OBJECTDB_CHUNK_BITS) | (i - 1));
 		}
-		slot_max = new_slot_max;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+	uint32_t slot = shard.free_slots[shard.free_slots.size() - 1];
+	shard.free_slots.resize(shard.free_slots.size() - 1);
+
+	ObjectSlot &object_slot = object_chunks[slot >> OBJECTDB_CHUNK_BITS].load(std::memory_order_relaxed)[slot & (OBJECTDB_CHUNK_SIZE - 1)];
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
+		shard.spin_lock.unlock();
+		ERR_FAIL_V_MSG(ObjectID(), "ObjectDB slot is still in use, this is a bug.");
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+
+	shard.validator_counter = (shard.validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
+	if (unlikely(shard.validator_counter == 0)) {
+		shard.validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
+	const uint64_t validator = shard.validator_counter;
+
+	// Both are release stores: a reader holding a stale ID that sees the new object must also see the
+	// validator cleared by remove_instance(), so get_instance() rejects it on its second validator check.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(validator, std::memory_order_release);
 
-	uint64_t id = validator_counter;
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2439,9 +2477,9 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
+	shard.slot_count.fetch_add(1, std::memory_order_relaxed);
 
-	spin_lock.unlock();
+	shard.spin_lock.unlock();
 
 	return ObjectID(id);
 }
@@ -2450,33 +2488,36 @@ void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
 
-	spin_lock.lock();
+	ObjectSlot &object_slot = object_chunks[slot >> OBJECTDB_CHUNK_BITS].load(std::memory_order_acquire)[slot & (OBJECTDB_CHUNK_SIZE - 1)];
+	// Slots go back to the shard that owns their chunk, whichever thread frees them.
+	ObjectShard &shard = shards[chunk_shards[slot >> OBJECTDB_CHUNK_BITS]];
+
+	shard.spin_lock.lock();
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
+		shard.spin_lock.unlock();
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+		if (object_slot.validator.load(std::memory_order_relaxed) != validator) {
+			shard.spin_lock.unlock();
+			ERR_FAIL_COND(object_slot.validator.load(std::memory_order_relaxed) != validator);
 		}
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.validator.store(0, std::memory_order_relaxed);
+	object_slot.object.store(nullptr, std::memory_order_release);
+
+	//set the free slot properly
+	shard.free_slots.push_back(slot);
+	shard.slot_count.fetch_sub(1, std::memory_order_relaxed);
 
-	spin_lock.unlock();
+	shard.spin_lock.unlock();
 }
 
 void ObjectDB::setup() {
@@ -2484,9 +2525,13 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	spin_lock.lock();
+	for (ObjectShard &shard : shards) {
+		shard.spin_lock.lock();
+	}
+
+	const uint32_t chunks = chunk_count.load(std::memory_order_acquire);
 
-	if (slot_count > 0) {
+	if (get_object_count() > 0) {
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
@@ -2496,9 +2541,14 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0; i < chunks; i++) {
+				ObjectSlot *chunk = object_chunks[i].load(std::memory_order_relaxed);
+				for (uint32_t j = 0; j < OBJECTDB_CHUNK_SIZE; j++) {
+					uint64_t validator = chunk[j].validator.load(std::memory_order_relaxed);
+					if (!validator) {
+						continue;
+					}
+					Object *obj = chunk[j].object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2508,20 +2558,24 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t slot = (uint64_t(i) << OBJECTDB_CHUNK_BITS) | j;
+					uint64_t id = slot | (validator << OBJECTDB_SLOT_MAX_COUNT_BITS) | (obj->is_ref_counted() ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
-
-					count--;
 				}
 			}
 			print_line("Hint: Leaked instances typically happen when nodes are removed from the scene tree (with `remove_child()`) but not freed (with `free()` or `queue_free()`).");
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < chunks; i++) {
+		memfree(object_chunks[i].load(std::memory_order_relaxed));
+		object_chunks[i].store(nullptr, std::memory_order_relaxed);
 	}
+	chunk_count.store(0, std::memory_order_relaxed);
 
-	spin_lock.unlock();
+	for (ObjectShard &shard : shards) {
+		shard.free_slots.reset();
+		shard.spin_lock.unlock();
+	}
 }
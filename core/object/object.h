@@ -39,6 +39,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -960,6 +961,7 @@ public:
 	}
 
 	void set_deferred(const StringName &p_property, const Variant &p_value);
+	void set_deferred_low_priority(const StringName &p_property, const Variant &p_value);
 
 	void set_block_signals(bool p_block);
 	bool is_blocking_signals() const;
@@ -1022,18 +1024,36 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+#define OBJECTDB_CHUNK_BITS 12
+#define OBJECTDB_CHUNK_SIZE (uint32_t(1) << OBJECTDB_CHUNK_BITS)
+#define OBJECTDB_CHUNK_MAX_COUNT (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_CHUNK_BITS))
+#define OBJECTDB_SHARD_COUNT 8
+
+	// Slots are read without locking. The validator is cleared before the object is,
+	// and the object is set before the validator is published, so a reader that sees
+	// the expected validator both before and after reading the object got the right one.
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		std::atomic<uint64_t> validator;
+		std::atomic<Object *> object;
+	};
+
+	// Slot allocation is split across shards so threads creating objects don't contend
+	// on a single lock. Each shard owns whole chunks of slots, and a slot's validator
+	// only ever increases within its shard, so IDs are never reused.
+	struct ObjectShard {
+		SpinLock spin_lock;
+		LocalVector<uint32_t> free_slots;
+		uint64_t validator_counter = 0;
+		std::atomic<uint32_t> slot_count = { 0 };
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	// Chunks are never moved or freed before cleanup, so readers can index them safely.
+	static std::atomic<ObjectSlot *> object_chunks[OBJECTDB_CHUNK_MAX_COUNT];
+	static uint8_t chunk_shards[OBJECTDB_CHUNK_MAX_COUNT];
+	static std::atomic<uint32_t> chunk_count;
+	static ObjectShard shards[OBJECTDB_SHARD_COUNT];
+
+	static uint32_t _get_thread_shard();
 
 	friend class Object;
 	friend void unregister_core_types();
@@ -1052,20 +1072,22 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ObjectSlot *chunk = object_chunks[slot >> OBJECTDB_CHUNK_BITS].load(std::memory_order_acquire);
+		ERR_FAIL_NULL_V(chunk, nullptr); // This should never happen unless RID is corrupted.
+		ObjectSlot &object_slot = chunk[slot & (OBJECTDB_CHUNK_SIZE - 1)];
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and reused while reading it.
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
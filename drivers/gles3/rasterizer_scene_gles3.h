@@ -40,6 +40,7 @@
 #include "drivers/gles3/shaders/effects/cubemap_filter.glsl.gen.h"
 #include "drivers/gles3/shaders/sky.glsl.gen.h"
 #include "scene/resources/mesh.h"
+#include "servers/rendering/render_list_radix_sort.h"
 #include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/renderer_scene_render.h"
 #include "servers/rendering_server.h"
@@ -658,22 +659,14 @@ private:
 			elements.clear();
 		}
 
-		//should eventually be replaced by radix
-
-		struct SortByKey {
-			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurface *A, const GeometryInstanceSurface *B) const {
-				return (A->sort.sort_key2 == B->sort.sort_key2) ? (A->sort.sort_key1 < B->sort.sort_key1) : (A->sort.sort_key2 < B->sort.sort_key2);
-			}
-		};
+		RenderListRadixSort<GeometryInstanceSurface> radix_sort;
 
 		void sort_by_key() {
-			SortArray<GeometryInstanceSurface *, SortByKey> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			radix_sort.sort(elements.ptr(), elements.size());
 		}
 
 		void sort_by_key_range(uint32_t p_from, uint32_t p_size) {
-			SortArray<GeometryInstanceSurface *, SortByKey> sorter;
-			sorter.sort(elements.ptr() + p_from, p_size);
+			radix_sort.sort(elements.ptr() + p_from, p_size);
 		}
 
 		struct SortByDepth {
@@ -1668,6 +1668,31 @@ void MeshStorage::_multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool
 	}
 }
 
+void MeshStorage::_multimesh_mark_range_dirty(MultiMesh *multimesh, int p_from, int p_count, bool p_aabb) {
+	uint32_t from_region = p_from / MULTIMESH_DIRTY_REGION_SIZE;
+	uint32_t to_region = (p_from + p_count - 1) / MULTIMESH_DIRTY_REGION_SIZE;
+#ifdef DEBUG_ENABLED
+	uint32_t data_cache_dirty_region_count = Math::division_round_up(multimesh->instances, MULTIMESH_DIRTY_REGION_SIZE);
+	ERR_FAIL_UNSIGNED_INDEX(to_region, data_cache_dirty_region_count); //bug
+#endif
+	for (uint32_t i = from_region; i <= to_region; i++) {
+		if (!multimesh->data_cache_dirty_regions[i]) {
+			multimesh->data_cache_dirty_regions[i] = true;
+			multimesh->data_cache_used_dirty_regions++;
+		}
+	}
+
+	if (p_aabb) {
+		multimesh->aabb_dirty = true;
+	}
+
+	if (!multimesh->dirty) {
+		multimesh->dirty_list = multimesh_dirty_list;
+		multimesh_dirty_list = multimesh;
+		multimesh->dirty = true;
+	}
+}
+
 void MeshStorage::_multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb) {
 	if (p_data) {
 		uint32_t data_cache_dirty_region_count = Math::division_round_up(multimesh->instances, MULTIMESH_DIRTY_REGION_SIZE);
@@ -2056,6 +2081,57 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->instances == 0);
+
+	uint32_t xform_size = multimesh->xform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12;
+	uint32_t old_stride = xform_size;
+	old_stride += multimesh->uses_colors ? 4 : 0;
+	old_stride += multimesh->uses_custom_data ? 4 : 0;
+	ERR_FAIL_COND_MSG(p_buffer.size() % old_stride != 0, vformat("Buffer size must be a multiple of the instance stride (%d floats), got %d instead.", old_stride, p_buffer.size()));
+
+	int instance_count = p_buffer.size() / old_stride;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + instance_count > multimesh->instances);
+
+	if (instance_count == 0) {
+		return;
+	}
+
+	if (instance_count == multimesh->instances) {
+		// Uploading everything doesn't need the data cache.
+		_multimesh_set_buffer(p_multimesh, p_buffer);
+		return;
+	}
+
+	_multimesh_make_local(multimesh);
+
+	// Colors and custom data are packed into half floats, the transform is copied as is.
+	const float *r = p_buffer.ptr();
+	float *w = multimesh->data_cache.ptrw() + p_first_instance * multimesh->stride_cache;
+
+	for (int i = 0; i < instance_count; i++) {
+		memcpy(w, r, xform_size * sizeof(float));
+
+		if (multimesh->uses_colors) {
+			const float *dataptr = r + xform_size;
+			uint16_t val[4] = { Math::make_half_float(dataptr[0]), Math::make_half_float(dataptr[1]), Math::make_half_float(dataptr[2]), Math::make_half_float(dataptr[3]) };
+			memcpy(w + multimesh->color_offset_cache, val, 2 * 4);
+		}
+		if (multimesh->uses_custom_data) {
+			const float *dataptr = r + xform_size + (multimesh->uses_colors ? 4 : 0);
+			uint16_t val[4] = { Math::make_half_float(dataptr[0]), Math::make_half_float(dataptr[1]), Math::make_half_float(dataptr[2]), Math::make_half_float(dataptr[3]) };
+			memcpy(w + multimesh->custom_data_offset_cache, val, 2 * 4);
+		}
+
+		r += old_stride;
+		w += multimesh->stride_cache;
+	}
+
+	_multimesh_mark_range_dirty(multimesh, p_first_instance, instance_count, true);
+}
+
 RID MeshStorage::_multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	ERR_FAIL_V_MSG(RID(), "GLES3 does not implement indirect multimeshes.");
 }
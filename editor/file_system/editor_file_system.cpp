@@ -245,7 +245,7 @@ void EditorFileSystem::_load_first_scan_root_dir() {
 	first_scan_root_dir = memnew(ScannedDirectory);
 	first_scan_root_dir->full_path = "res://";
 
-	nb_files_total = _scan_new_dir(first_scan_root_dir, d);
+	nb_files_total = _scan_new_dir(first_scan_root_dir, d, true);
 }
 
 void EditorFileSystem::scan_for_uid() {
@@ -510,7 +510,7 @@ void EditorFileSystem::_scan_filesystem() {
 		Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
 		sd = memnew(ScannedDirectory);
 		sd->full_path = "res://";
-		nb_files_total = _scan_new_dir(sd, d);
+		nb_files_total = _scan_new_dir(sd, d, true);
 	}
 
 	_process_file_system(sd, new_filesystem, sp, processed_files);
@@ -1130,7 +1130,7 @@ void EditorFileSystem::ScanProgress::increment() {
 	EditorFileSystem::singleton->scan_total = ratio;
 }
 
-int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da) {
+int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da, bool p_threaded, LocalVector<String> *r_nested_projects) {
 	List<String> dirs;
 	List<String> files;
 
@@ -1152,7 +1152,7 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 				continue;
 			}
 
-			if (_should_skip_directory(cd.path_join(f))) {
+			if (_should_skip_directory(cd.path_join(f), r_nested_projects)) {
 				continue;
 			}
 
@@ -1170,6 +1170,54 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 
 	int nb_files_total_scan = 0;
 
+	if (p_threaded && dirs.size() > 1) {
+		// Each top-level directory is walked by its own task. Only the symlink loop check is done here,
+		// the actual listing happens in _scan_new_dir_task with a separate DirAccess per task.
+		for (const String &dir : dirs) {
+			if (da->change_dir(dir) == OK) {
+				String d = da->get_current_dir();
+				if (d != cd && d.begins_with(cd)) {
+					ScannedDirectory *sd = memnew(ScannedDirectory);
+					sd->name = dir;
+					sd->full_path = p_dir->full_path.path_join(sd->name);
+					p_dir->subdirs.push_back(sd);
+				}
+				da->change_dir(cd);
+			} else {
+				ERR_PRINT("Cannot go into subdir '" + dir + "'.");
+			}
+		}
+
+		LocalVector<int> nb_files;
+		nb_files.resize(p_dir->subdirs.size());
+		LocalVector<LocalVector<String>> nested_projects;
+		nested_projects.resize(p_dir->subdirs.size());
+
+		ScanNewDirTaskData task_data;
+		task_data.dirs = p_dir->subdirs.ptrw();
+		task_data.nb_files = nb_files.ptr();
+		task_data.nested_projects = nested_projects.ptr();
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&EditorFileSystem::_scan_new_dir_task, &task_data, p_dir->subdirs.size(), -1, true, SNAME("ScanFileSystem"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (int nb : nb_files) {
+			nb_files_total_scan += nb;
+		}
+
+		// Warned about here rather than in the tasks, the warning isn't thread-safe.
+		for (const LocalVector<String> &task_nested_projects : nested_projects) {
+			for (const String &path : task_nested_projects) {
+				_warn_nested_project(path);
+			}
+		}
+
+		p_dir->files = files;
+		nb_files_total_scan += files.size();
+
+		return nb_files_total_scan;
+	}
+
 	for (const String &dir : dirs) {
 		if (da->change_dir(dir) == OK) {
 			String d = da->get_current_dir();
@@ -1181,7 +1229,7 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 				sd->name = dir;
 				sd->full_path = p_dir->full_path.path_join(sd->name);
 
-				nb_files_total_scan += _scan_new_dir(sd, da);
+				nb_files_total_scan += _scan_new_dir(sd, da, false, r_nested_projects);
 
 				p_dir->subdirs.push_back(sd);
 
@@ -1198,6 +1246,20 @@ int EditorFileSystem::_scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da)
 	return nb_files_total_scan;
 }
 
+void EditorFileSystem::_scan_new_dir_task(void *p_userdata, uint32_t p_index) {
+	ScanNewDirTaskData *task_data = static_cast<ScanNewDirTaskData *>(p_userdata);
+	ScannedDirectory *sd = task_data->dirs[p_index];
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
+	if (da->change_dir(sd->full_path) != OK) {
+		ERR_PRINT("Cannot go into subdir '" + sd->full_path + "'.");
+		task_data->nb_files[p_index] = 0;
+		return;
+	}
+
+	task_data->nb_files[p_index] = _scan_new_dir(sd, da, false, &task_data->nested_projects[p_index]);
+}
+
 void EditorFileSystem::_process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress, HashSet<String> *r_processed_files) {
 	p_dir->modified_time = FileAccess::get_modified_time(p_scan_dir->full_path);
 
@@ -2772,6 +2834,85 @@ Error EditorFileSystem::_reimport_group(const String &p_group_file, const Vector
 	return err;
 }
 
+String EditorFileSystem::_get_import_cache_key(const String &p_file, ResourceUID::ID p_uid, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const {
+	// The path and UID are part of the key, as some importers embed them in the imported resources.
+	String key = FileAccess::get_sha256(p_file);
+	key += "::" + p_file + "::" + ResourceUID::get_singleton()->id_to_text(p_uid);
+	key += "::" + p_importer->get_importer_name() + "::" + itos(p_importer->get_format_version());
+	key += "::" + ResourceFormatImporter::get_singleton()->get_import_settings_hash();
+
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		String value;
+		VariantWriter::write_to_string(p_params[E.option.name], value);
+		key += "::" + String(E.option.name) + "=" + value;
+	}
+
+	return key.sha256_text();
+}
+
+bool EditorFileSystem::_import_cache_restore(const String &p_cache_dir, const String &p_base_path, List<String> &r_import_variants, Variant &r_metadata) const {
+	// The entry file is written last, so its presence means all the imported files are in the cache.
+	const String entry_path = p_cache_dir.path_join("entry.cfg");
+	if (!FileAccess::exists(entry_path)) {
+		return false;
+	}
+
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	if (cf->load(entry_path) != OK) {
+		return false;
+	}
+
+	const Vector<String> files = cf->get_value("entry", "files", Vector<String>());
+	if (files.is_empty()) {
+		return false;
+	}
+
+	for (const String &file : files) {
+		if (DirAccess::copy_absolute(p_cache_dir.path_join(file), p_base_path + "." + file) != OK) {
+			return false;
+		}
+	}
+
+	const Vector<String> variants = cf->get_value("entry", "variants", Vector<String>());
+	for (const String &variant : variants) {
+		r_import_variants.push_back(variant);
+	}
+	r_metadata = cf->get_value("entry", "metadata", Variant());
+
+	return true;
+}
+
+void EditorFileSystem::_import_cache_store(const String &p_cache_dir, const String &p_base_path, const String &p_save_extension, const List<String> &p_import_variants, const Variant &p_metadata) const {
+	Error err = DirAccess::make_dir_recursive_absolute(p_cache_dir);
+	ERR_FAIL_COND_MSG(err != OK, vformat("Cannot create import cache directory '%s'.", p_cache_dir));
+
+	Vector<String> files;
+	Vector<String> variants;
+	if (p_import_variants.size()) {
+		for (const String &E : p_import_variants) {
+			files.push_back(E + "." + p_save_extension);
+			variants.push_back(E);
+		}
+	} else {
+		files.push_back(p_save_extension);
+	}
+
+	for (const String &file : files) {
+		err = DirAccess::copy_absolute(p_base_path + "." + file, p_cache_dir.path_join(file));
+		ERR_FAIL_COND_MSG(err != OK, vformat("Cannot store '%s' in the import cache.", p_base_path + "." + file));
+	}
+
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	cf->set_value("entry", "files", files);
+	cf->set_value("entry", "variants", variants);
+	if (p_metadata != Variant()) {
+		cf->set_value("entry", "metadata", p_metadata);
+	}
+	cf->save(p_cache_dir.path_join("entry.cfg"));
+}
+
 Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<StringName, Variant> &p_custom_options, const String &p_custom_importer, Variant *p_generator_parameters, bool p_update_file_system) {
 	print_verbose(vformat("EditorFileSystem: Importing file: %s", p_file));
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
@@ -2896,7 +3037,27 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err = OK;
+
+	// When a shared import cache is configured, reuse the output of an identical previous import
+	// (same source contents, importer, options and import settings) instead of importing again.
+	// Only importers that don't read other files opt in, as changes to those wouldn't be part of the key.
+	String import_cache_dir;
+	const String import_cache_path = EDITOR_GET("filesystem/import/shared_cache_path");
+	if (!import_cache_path.is_empty() && !importer->get_save_extension().is_empty() && importer->can_use_shared_import_cache(params)) {
+		import_cache_dir = import_cache_path.path_join(_get_import_cache_key(p_file, uid, importer, opts, params));
+	}
+
+	if (!import_cache_dir.is_empty() && _import_cache_restore(import_cache_dir, base_path, import_variants, meta)) {
+		print_verbose(vformat("EditorFileSystem: \"%s\" restored from import cache.", p_file));
+	} else {
+		err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+		// Imports which generate additional files can't be restored from a single cache entry.
+		if (err == OK && !import_cache_dir.is_empty() && gen_files.is_empty()) {
+			_import_cache_store(import_cache_dir, base_path, importer->get_save_extension(), import_variants, meta);
+		}
+	}
 
 	// As import is complete, save the .import file.
 
@@ -3434,7 +3595,13 @@ Ref<Resource> EditorFileSystem::_load_resource_on_startup(ResourceFormatImporter
 	return res;
 }
 
-bool EditorFileSystem::_should_skip_directory(const String &p_path) {
+void EditorFileSystem::_warn_nested_project(const String &p_path) {
+	if (EditorFileSystem::get_singleton()->first_scan) {
+		WARN_PRINT_ONCE(vformat("Detected another project.godot at %s. The folder will be ignored.", p_path));
+	}
+}
+
+bool EditorFileSystem::_should_skip_directory(const String &p_path, LocalVector<String> *r_nested_projects) {
 	String project_data_path = ProjectSettings::get_singleton()->get_project_data_path();
 	if (p_path == project_data_path || p_path.begins_with(project_data_path + "/")) {
 		return true;
@@ -3442,8 +3609,10 @@ bool EditorFileSystem::_should_skip_directory(const String &p_path) {
 
 	if (FileAccess::exists(p_path.path_join("project.godot"))) {
 		// Skip if another project inside this.
-		if (EditorFileSystem::get_singleton()->first_scan) {
-			WARN_PRINT_ONCE(vformat("Detected another project.godot at %s. The folder will be ignored.", p_path));
+		if (r_nested_projects) {
+			r_nested_projects->push_back(p_path);
+		} else {
+			_warn_nested_project(p_path);
 		}
 		return true;
 	}
@@ -258,7 +258,14 @@ class EditorFileSystem : public Node {
 	HashSet<String> valid_extensions;
 	HashSet<String> import_extensions;
 
-	static int _scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da);
+	struct ScanNewDirTaskData {
+		ScannedDirectory **dirs = nullptr;
+		int *nb_files = nullptr;
+		LocalVector<String> *nested_projects = nullptr;
+	};
+
+	static int _scan_new_dir(ScannedDirectory *p_dir, Ref<DirAccess> &da, bool p_threaded = false, LocalVector<String> *r_nested_projects = nullptr);
+	static void _scan_new_dir_task(void *p_userdata, uint32_t p_index);
 	void _process_file_system(const ScannedDirectory *p_scan_dir, EditorFileSystemDirectory *p_dir, ScanProgress &p_progress, HashSet<String> *p_processed_files);
 
 	Thread thread_sources;
@@ -274,6 +281,9 @@ class EditorFileSystem : public Node {
 
 	void _update_extensions();
 
+	String _get_import_cache_key(const String &p_file, ResourceUID::ID p_uid, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const;
+	bool _import_cache_restore(const String &p_cache_dir, const String &p_base_path, List<String> &r_import_variants, Variant &r_metadata) const;
+	void _import_cache_store(const String &p_cache_dir, const String &p_base_path, const String &p_save_extension, const List<String> &p_import_variants, const Variant &p_metadata) const;
 	Error _reimport_file(const String &p_file, const HashMap<StringName, Variant> &p_custom_options = HashMap<StringName, Variant>(), const String &p_custom_importer = String(), Variant *generator_parameters = nullptr, bool p_update_file_system = true);
 	Error _reimport_group(const String &p_group_file, const Vector<String> &p_files);
 
@@ -410,7 +420,8 @@ public:
 	Error copy_file(const String &p_from, const String &p_to);
 	Error copy_directory(const String &p_from, const String &p_to);
 
-	static bool _should_skip_directory(const String &p_path);
+	static void _warn_nested_project(const String &p_path);
+	static bool _should_skip_directory(const String &p_path, LocalVector<String> *r_nested_projects = nullptr);
 
 	static void scan_for_uid();
 
@@ -698,6 +698,19 @@ void ResourceImporterTexture::_clamp_hdr_exposure(Ref<Image> &r_image) {
 	}
 }
 
+bool ResourceImporterTexture::can_use_shared_import_cache(const HashMap<StringName, Variant> &p_options) const {
+	// The normal map used for roughness is read from another file, which isn't part of the cache key.
+	if (!String(p_options["roughness/src_normal"]).is_empty()) {
+		return false;
+	}
+
+	// The editor variant is saved to extra files that the cache doesn't store,
+	// and depends on the editor scale and theme, which aren't part of the key either.
+	const bool use_editor_scale = p_options.has("editor/scale_with_editor_scale") && p_options["editor/scale_with_editor_scale"];
+	const bool convert_editor_colors = p_options.has("editor/convert_colors_with_editor_theme") && p_options["editor/convert_colors_with_editor_theme"];
+	return !use_editor_scale && !convert_editor_colors;
+}
+
 Error ResourceImporterTexture::import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files, Variant *r_metadata) {
 	// Parse import options.
 	int32_t loader_flags = ImageFormatLoader::FLAG_NONE;
@@ -129,6 +129,8 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(TIME_PROCESS_THREAD_GROUPS);
+	BIND_ENUM_CONSTANT(TIME_PHYSICS_PROCESS_THREAD_GROUPS);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -209,6 +211,8 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("time/process_thread_groups"),
+		PNAME("time/physics_process_thread_groups"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -432,6 +436,14 @@ double Performance::get_monitor(Monitor p_monitor) const {
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+		case TIME_PROCESS_THREAD_GROUPS: {
+			SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+			return sml ? USEC_TO_SEC(sml->get_process_critical_path_usec()) : 0;
+		}
+		case TIME_PHYSICS_PROCESS_THREAD_GROUPS: {
+			SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+			return sml ? USEC_TO_SEC(sml->get_physics_process_critical_path_usec()) : 0;
+		}
 
 		default: {
 		}
@@ -503,6 +515,8 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -125,6 +125,8 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		TIME_PROCESS_THREAD_GROUPS,
+		TIME_PHYSICS_PROCESS_THREAD_GROUPS,
 		MONITOR_MAX
 	};
 
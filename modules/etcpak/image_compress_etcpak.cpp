@@ -32,12 +32,16 @@
 
 #ifdef TOOLS_ENABLED
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <ProcessDxtc.hpp>
 #include <ProcessRGB.hpp>
 
+// Mip levels with fewer block rows than this are compressed on the calling thread.
+static constexpr int ETCPAK_MIN_THREADED_BLOCK_ROWS = 64;
+
 EtcpakType _determine_etc_type(Image::UsedChannels p_channels) {
 	switch (p_channels) {
 		case Image::USED_CHANNELS_L:
@@ -90,6 +94,66 @@ void _compress_bc(Image *r_img, Image::UsedChannels p_channels) {
 	_compress_etcpak(_determine_dxt_type(p_channels), r_img);
 }
 
+static void _compress_etcpak_blocks(EtcpakType p_compress_type, const uint32_t *p_src, uint64_t *p_dst, uint32_t p_blocks, size_t p_width) {
+	switch (p_compress_type) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+			CompressEtc2Rgba(p_src, p_dst, p_blocks, p_width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_R:
+			CompressEacR(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+			CompressEacRg(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressBc1Dither(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+			CompressBc3(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_R:
+			CompressBc4(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			CompressBc5(p_src, p_dst, p_blocks, p_width);
+			break;
+
+		default:
+			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+			break;
+	}
+}
+
+struct EtcpakCompressRowsData {
+	EtcpakType compress_type;
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	int width = 0;
+	int64_t dst_row_words = 0;
+};
+
+static void _compress_etcpak_block_row(void *p_userdata, uint32_t p_row) {
+	const EtcpakCompressRowsData *data = static_cast<const EtcpakCompressRowsData *>(p_userdata);
+	// Each block row covers 4 rows of source pixels.
+	_compress_etcpak_blocks(data->compress_type, data->src + (int64_t)p_row * 4 * data->width, data->dst + p_row * data->dst_row_words, data->width / 4, data->width);
+}
+
 void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -255,48 +319,20 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 			src_mip_read = padded_src.ptr();
 		}
 
-		switch (p_compress_type) {
-			case EtcpakType::ETCPAK_TYPE_ETC1:
-				CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2:
-				CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
-			case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
-				CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_R:
-				CompressEacR(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_RG:
-				CompressEacRg(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT1:
-				CompressBc1Dither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT5:
-			case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
-				CompressBc3(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_R:
-				CompressBc4(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_RG:
-				CompressBc5(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			default:
-				ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-				break;
+		const int block_rows = dest_mip_h / 4;
+		if (block_rows >= ETCPAK_MIN_THREADED_BLOCK_ROWS) {
+			// Large mip levels are compressed in parallel, one block row per task element.
+			EtcpakCompressRowsData rows_data;
+			rows_data.compress_type = p_compress_type;
+			rows_data.src = src_mip_read;
+			rows_data.dst = dest_mip_write;
+			rows_data.width = dest_mip_w;
+			rows_data.dst_row_words = Image::get_image_data_size(dest_mip_w, 4, target_format, false) / 8;
+
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_etcpak_block_row, &rows_data, block_rows, -1, true, SNAME("EtcpakCompress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_compress_etcpak_blocks(p_compress_type, src_mip_read, dest_mip_write, blocks, dest_mip_w);
 		}
 	}
 
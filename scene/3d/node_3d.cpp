@@ -108,11 +108,13 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	for (Node3D *&E : data.children) {
-		if (E->data.top_level) {
+	// No user code runs while propagating, so the children can't change under the loop.
+	for (uint32_t i = 0; i < data.node3d_children.size(); i++) {
+		Node3D *child = data.node3d_children[i];
+		if (child->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
-		E->_propagate_transform_changed(p_origin);
+		child->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
 	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
@@ -129,6 +131,22 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
 }
 
+void Node3D::_node3d_remove_child(Node3D *p_child) {
+	const uint32_t index = p_child->data.index_in_parent;
+	ERR_FAIL_UNSIGNED_INDEX(index, data.node3d_children.size());
+	ERR_FAIL_COND(data.node3d_children[index] != p_child);
+
+	// Swap the last child into the freed slot.
+	const uint32_t last = data.node3d_children.size() - 1;
+	if (index != last) {
+		Node3D *moved = data.node3d_children[last];
+		data.node3d_children[index] = moved;
+		moved->data.index_in_parent = index;
+	}
+	data.node3d_children.resize(last);
+	p_child->data.index_in_parent = UINT32_MAX;
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ACCESSIBILITY_UPDATE: {
@@ -148,9 +166,10 @@ void Node3D::_notification(int p_what) {
 			}
 
 			if (data.parent) {
-				data.C = data.parent->data.children.push_back(this);
+				data.index_in_parent = data.parent->data.node3d_children.size();
+				data.parent->data.node3d_children.push_back(this);
 			} else {
-				data.C = nullptr;
+				data.index_in_parent = UINT32_MAX;
 			}
 
 			if (data.top_level && !Engine::get_singleton()->is_editor_hint()) {
@@ -202,11 +221,11 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
-			if (data.C) {
-				data.parent->data.children.erase(data.C);
+			if (data.parent && data.index_in_parent != UINT32_MAX) {
+				data.parent->_node3d_remove_child(this);
 			}
 			data.parent = nullptr;
-			data.C = nullptr;
+			data.index_in_parent = UINT32_MAX;
 			_update_visibility_parent(true);
 			_disable_client_physics_interpolation();
 		} break;
@@ -1070,12 +1089,23 @@ void Node3D::_propagate_visibility_changed() {
 	}
 #endif
 
-	for (Node3D *c : data.children) {
-		if (!c || !c->data.visible) {
+	// Signal handlers may add, remove or free siblings, so iterate over a snapshot and skip the ones that left.
+	// The snapshots of the whole propagation share one stack, each level only reads and pops its own range.
+	thread_local LocalVector<ObjectID> children;
+	const uint32_t from = children.size();
+	for (const Node3D *c : data.node3d_children) {
+		children.push_back(c->get_instance_id());
+	}
+	const uint32_t to = children.size();
+
+	for (uint32_t i = from; i < to; i++) {
+		Node3D *c = ObjectDB::get_instance<Node3D>(children[i]);
+		if (!c || c->data.parent != this || !c->data.visible) {
 			continue;
 		}
 		c->_propagate_visibility_changed();
 	}
+	children.resize(from);
 }
 
 void Node3D::show() {
@@ -1307,8 +1337,8 @@ void Node3D::_update_visibility_parent(bool p_update_root) {
 		RS::get_singleton()->instance_set_visibility_parent(vi->get_instance(), data.visibility_parent);
 	}
 
-	for (Node3D *c : data.children) {
-		c->_update_visibility_parent(false);
+	for (uint32_t i = 0; i < data.node3d_children.size(); i++) {
+		data.node3d_children[i]->_update_visibility_parent(false);
 	}
 }
 
@@ -150,8 +150,12 @@ private:
 		RID visibility_parent;
 
 		Node3D *parent = nullptr;
-		List<Node3D *> children;
-		List<Node3D *>::Element *C = nullptr;
+
+		// Contiguous list of Node3D children, used when propagating transform and visibility changes.
+		// Order is not preserved on removal, each child stores its own index for O(1) removal, so siblings
+		// may be notified of transform and visibility changes in a different order than the scene tree.
+		LocalVector<Node3D *> node3d_children;
+		uint32_t index_in_parent = UINT32_MAX;
 
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
@@ -176,6 +180,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _node3d_remove_child(Node3D *p_child);
 
 	void _propagate_visibility_changed();
 
@@ -47,6 +47,7 @@
 int Node::orphan_node_count = 0;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
+SafeNumeric<uint64_t> Node::node_path_version(1);
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -1230,6 +1231,15 @@ BitField<Node::ProcessThreadMessages> Node::get_process_thread_messages() const
 	return data.process_thread_messages;
 }
 
+void Node::set_process_thread_group_parallel(bool p_enabled) {
+	ERR_THREAD_GUARD
+	data.process_thread_group_parallel = p_enabled;
+}
+
+bool Node::is_process_thread_group_parallel() const {
+	return data.process_thread_group_parallel;
+}
+
 void Node::set_process_input(bool p_enable) {
 	ERR_THREAD_GUARD
 	if (p_enable == data.input) {
@@ -1412,6 +1422,7 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 	data.name = p_name;
+	_invalidate_node_paths();
 }
 
 void Node::set_name(const StringName &p_name) {
@@ -1433,6 +1444,8 @@ void Node::set_name(const StringName &p_name) {
 		}
 	}
 
+	_invalidate_node_paths();
+
 	if (data.parent) {
 		data.parent->_validate_child_name(this, true);
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
@@ -1641,6 +1654,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	_invalidate_node_paths();
 
 	p_child->data.internal_mode = p_internal_mode;
 	switch (p_internal_mode) {
@@ -1676,18 +1690,18 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 	emit_signal(SNAME("child_order_changed"));
 }
 
-void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_internal) {
-	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_child\",node).");
-
-	ERR_THREAD_GUARD
-	ERR_FAIL_NULL(p_child);
-	ERR_FAIL_COND_MSG(p_child == this, vformat("Can't add child '%s' to itself.", p_child->get_name())); // adding to itself!
-	ERR_FAIL_COND_MSG(p_child->data.parent, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", p_child->get_name(), get_name(), p_child->data.parent->get_name())); //Fail if node has a parent
+bool Node::_can_add_child(const Node *p_child) const {
+	ERR_FAIL_NULL_V(p_child, false);
+	ERR_FAIL_COND_V_MSG(p_child == this, false, vformat("Can't add child '%s' to itself.", p_child->get_name())); // adding to itself!
+	ERR_FAIL_COND_V_MSG(p_child->data.parent, false, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", p_child->get_name(), get_name(), p_child->data.parent->get_name())); //Fail if node has a parent
 #ifdef DEBUG_ENABLED
-	ERR_FAIL_COND_MSG(p_child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", p_child->get_name(), get_name(), p_child->get_name(), get_name()));
+	ERR_FAIL_COND_V_MSG(p_child->is_ancestor_of(this), false, vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", p_child->get_name(), get_name(), p_child->get_name(), get_name()));
 #endif
-	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `add_child()` failed. Consider using `add_child.call_deferred(child)` instead.");
+	ERR_FAIL_COND_V_MSG(data.blocked > 0, false, "Parent node is busy setting up children, `add_child()` failed. Consider using `add_child.call_deferred(child)` instead.");
+	return true;
+}
 
+void Node::_add_child_validated(Node *p_child, bool p_force_readable_name, InternalMode p_internal) {
 	_validate_child_name(p_child, p_force_readable_name);
 
 #ifdef DEBUG_ENABLED
@@ -1700,6 +1714,53 @@ void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_i
 	_add_child_nocheck(p_child, p_child->data.name, p_internal);
 }
 
+void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_internal) {
+	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_child\",node).");
+
+	ERR_THREAD_GUARD
+	if (!_can_add_child(p_child)) {
+		return;
+	}
+
+	_add_child_validated(p_child, p_force_readable_name, p_internal);
+}
+
+void Node::add_children(const TypedArray<Node> &p_children, bool p_force_readable_name, InternalMode p_internal) {
+	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_children\",nodes).");
+
+	ERR_THREAD_GUARD
+	const int count = p_children.size();
+	if (count == 0) {
+		return;
+	}
+
+	// Grow the lookup tables once for the whole batch instead of rehashing as they fill up.
+	data.children.reserve(data.children.size() + count);
+	if (!data.children_cache_dirty) {
+		data.children_cache.reserve(data.children_cache.size() + count);
+	}
+
+	// Each child is still inserted and notified in array order, exactly as a sequence
+	// of add_child() calls would, so callbacks observe the same tree at every step.
+	const ObjectID self_id = get_instance_id();
+	for (int i = 0; i < count; i++) {
+		if (i > 0 && !ObjectDB::get_instance(self_id)) {
+			// Freed by a callback of an earlier child, the rest can't be added anymore.
+			return;
+		}
+
+		// Fetched lazily and validated, as callbacks of earlier children may have freed later ones.
+		Node *child = Object::cast_to<Node>(p_children[i].get_validated_object());
+		if (!child) {
+			continue;
+		}
+		if (!_can_add_child(child)) {
+			continue;
+		}
+		_add_child_validated(child, p_force_readable_name, p_internal);
+	}
+}
+
 void Node::add_sibling(Node *p_sibling, bool p_force_readable_name) {
 	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Adding a sibling to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_sibling\",node).");
 	ERR_FAIL_NULL(p_sibling);
@@ -1742,6 +1803,7 @@ void Node::remove_child(Node *p_child) {
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
+	_invalidate_node_paths();
 
 	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
 	emit_signal(SNAME("child_order_changed"));
@@ -1841,6 +1903,33 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	if (p_path.get_name_count() < 2) {
+		// A single name is at most a couple of hash lookups already.
+		return _resolve_node_path(p_path);
+	}
+
+	// Multi-name paths are cached per node until the tree structure changes anywhere.
+	const uint64_t version = node_path_version.get();
+	if (data.node_path_cache_version != version) {
+		data.node_path_cache.clear();
+		data.node_path_cache_version = version;
+	} else {
+		Node *const *cached = data.node_path_cache.getptr(p_path);
+		if (cached) {
+			return *cached;
+		}
+	}
+
+	Node *node = _resolve_node_path(p_path);
+	if (data.node_path_cache.size() >= NODE_PATH_CACHE_MAX) {
+		// Don't let dynamically built paths grow the cache without bound.
+		data.node_path_cache.clear();
+	}
+	data.node_path_cache.insert(p_path, node);
+	return node;
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -2152,6 +2241,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	data.owner = p_owner;
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
+	_invalidate_node_paths();
 
 	owner_changed_notify();
 }
@@ -2164,6 +2254,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	_invalidate_node_paths();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2178,6 +2269,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	_invalidate_node_paths();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2241,6 +2333,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	_invalidate_node_paths();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -2398,17 +2491,14 @@ void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 		return;
 	}
 
-	GroupData gd;
+	// Register the group first, as SceneTree stores the node's index in it.
+	GroupData &gd = data.grouped[p_identifier];
+	gd.persistent = p_persistent;
 
 	if (data.tree) {
 		gd.group = data.tree->add_to_group(p_identifier, this);
-	} else {
-		gd.group = nullptr;
 	}
 
-	gd.persistent = p_persistent;
-
-	data.grouped[p_identifier] = gd;
 	if (p_persistent) {
 		_emit_editor_state_changed();
 	}
@@ -2542,13 +2632,54 @@ void Node::_propagate_deferred_notification(int p_notification, bool p_reverse)
 
 void Node::propagate_notification(int p_notification) {
 	ERR_THREAD_GUARD
-	data.blocked++;
-	notification(p_notification);
+	if (data.children.is_empty()) {
+		data.blocked++;
+		notification(p_notification);
+		data.blocked--;
+		return;
+	}
 
-	for (KeyValue<StringName, Node *> &K : data.children) {
-		K.value->propagate_notification(p_notification);
+	// Pre-order walk with an explicit stack rather than recursion, so notifying whole trees
+	// doesn't pay a call frame per node. Each node stays blocked until its subtree is done,
+	// and children are visited in the same order as the recursive version did.
+	// The stack is reused across calls so it doesn't allocate once warmed up. Notifications
+	// may propagate other notifications, so each call only pops the entries above its base.
+	struct Visit {
+		Node *node = nullptr;
+		bool leave = false;
+	};
+	thread_local LocalVector<Visit> stack;
+	const uint32_t base = stack.size();
+	stack.push_back({ this, false });
+
+	while (stack.size() > base) {
+		const Visit visit = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+		Node *node = visit.node;
+
+		if (visit.leave) {
+			node->data.blocked--;
+			continue;
+		}
+
+		node->data.blocked++;
+		node->notification(p_notification);
+
+		if (node->data.children.is_empty()) {
+			node->data.blocked--;
+			continue;
+		}
+
+		stack.push_back({ node, true });
+		const uint32_t first = stack.size();
+		for (KeyValue<StringName, Node *> &K : node->data.children) {
+			stack.push_back({ K.value, false });
+		}
+		// Reverse so the first child is on top of the stack.
+		for (uint32_t i = first, j = stack.size() - 1; i < j; i++, j--) {
+			SWAP(stack[i], stack[j]);
+		}
 	}
-	data.blocked--;
 }
 
 void Node::propagate_call(const StringName &p_method, const Array &p_args, const bool p_parent_first) {
@@ -3561,6 +3692,9 @@ void Node::_validate_property(PropertyInfo &p_property) const {
 	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
 		p_property.usage = 0;
 	}
+	if (p_property.name == "process_thread_group_parallel" && data.process_thread_group != PROCESS_THREAD_GROUP_SUB_THREAD) {
+		p_property.usage = 0;
+	}
 }
 
 void Node::input(const Ref<InputEvent> &p_event) {
@@ -3705,6 +3839,7 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_name", "name"), &Node::set_name);
 	ClassDB::bind_method(D_METHOD("get_name"), &Node::get_name);
 	ClassDB::bind_method(D_METHOD("add_child", "node", "force_readable_name", "internal"), &Node::add_child, DEFVAL(false), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("add_children", "nodes", "force_readable_name", "internal"), &Node::add_children, DEFVAL(false), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("remove_child", "node"), &Node::remove_child);
 	ClassDB::bind_method(D_METHOD("reparent", "new_parent", "keep_global_transform"), &Node::reparent, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("get_child_count", "include_internal"), &Node::get_child_count, DEFVAL(false)); // Note that the default value bound for include_internal is false, while the method is declared with true. This is because internal nodes are irrelevant for GDSCript.
@@ -3770,6 +3905,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_thread_messages", "flags"), &Node::set_process_thread_messages);
 	ClassDB::bind_method(D_METHOD("get_process_thread_messages"), &Node::get_process_thread_messages);
 
+	ClassDB::bind_method(D_METHOD("set_process_thread_group_parallel", "enabled"), &Node::set_process_thread_group_parallel);
+	ClassDB::bind_method(D_METHOD("is_process_thread_group_parallel"), &Node::is_process_thread_group_parallel);
+
 	ClassDB::bind_method(D_METHOD("set_process_thread_group_order", "order"), &Node::set_process_thread_group_order);
 	ClassDB::bind_method(D_METHOD("get_process_thread_group_order"), &Node::get_process_thread_group_order);
 
@@ -3993,6 +4131,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "process_thread_group_parallel"), "set_process_thread_group_parallel", "is_process_thread_group_parallel");
 
 	ADD_GROUP("Physics Interpolation", "physics_interpolation_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_interpolation_mode", PROPERTY_HINT_ENUM, "Inherit,On,Off"), "set_physics_interpolation_mode", "get_physics_interpolation_mode");
@@ -136,6 +136,7 @@ private:
 	struct GroupData {
 		bool persistent = false;
 		SceneTree::Group *group = nullptr;
+		uint32_t index = 0; // Position in group->nodes, maintained by SceneTree.
 	};
 
 	struct ComparatorByIndex {
@@ -171,6 +172,8 @@ private:
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
+		mutable HashMap<NodePath, Node *> node_path_cache; // Multi-name lookups resolved from this node.
+		mutable uint64_t node_path_cache_version = 0;
 		InternalMode internal_mode = INTERNAL_MODE_DISABLED;
 		mutable int internal_children_front_count_cache = 0;
 		mutable int internal_children_back_count_cache = 0;
@@ -199,6 +202,7 @@ private:
 		Node *process_thread_group_owner = nullptr;
 		int process_thread_group_order = 0;
 		BitField<ProcessThreadMessages> process_thread_messages = {};
+		bool process_thread_group_parallel = false;
 		void *process_group = nullptr; // to avoid cyclic dependency
 
 		int multiplayer_authority = 1; // Server by default.
@@ -328,6 +332,13 @@ private:
 
 	static thread_local Node *current_process_thread_group;
 
+	// Bumped whenever a change could alter how a NodePath resolves (reparenting, renaming,
+	// unique name or owner changes), invalidating every node's `node_path_cache` at once.
+	static SafeNumeric<uint64_t> node_path_version;
+	static constexpr uint32_t NODE_PATH_CACHE_MAX = 64;
+	_FORCE_INLINE_ static void _invalidate_node_paths() { node_path_version.increment(); }
+	Node *_resolve_node_path(const NodePath &p_path) const;
+
 	Variant _call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_thread_safe_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -359,6 +370,8 @@ protected:
 	friend class SceneState;
 
 	void _add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode = INTERNAL_MODE_DISABLED);
+	bool _can_add_child(const Node *p_child) const;
+	void _add_child_validated(Node *p_child, bool p_force_readable_name, InternalMode p_internal);
 	void _set_owner_nocheck(Node *p_owner);
 	void _set_name_nocheck(const StringName &p_name);
 
@@ -481,6 +494,7 @@ public:
 	InternalMode get_internal_mode() const;
 
 	void add_child(Node *p_child, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
+	void add_children(const TypedArray<Node> &p_children, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
 	void add_sibling(Node *p_sibling, bool p_force_readable_name = false);
 	void remove_child(Node *p_child);
 
@@ -669,6 +683,9 @@ public:
 	void set_process_thread_messages(BitField<ProcessThreadMessages> p_flags);
 	BitField<ProcessThreadMessages> get_process_thread_messages() const;
 
+	void set_process_thread_group_parallel(bool p_enabled);
+	bool is_process_thread_group_parallel() const;
+
 	void queue_accessibility_update();
 
 	virtual RID get_accessibility_element() const;
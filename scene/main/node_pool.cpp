@@ -0,0 +1,374 @@
+/**************************************************************************/
+/*  node_pool.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "node_pool.h"
+
+Node *NodePool::_instantiate() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "NodePool has no scene to instantiate.");
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	if (!reset_state_captured) {
+		_capture_reset_state(node);
+	}
+	return node;
+}
+
+void NodePool::_capture_reset_state(Node *p_root) {
+	reset_state.clear();
+
+	LocalVector<Node *> stack;
+	stack.push_back(p_root);
+	while (!stack.is_empty()) {
+		Node *node = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+
+		NodeResetState state;
+		state.path = p_root->get_path_to(node);
+
+		List<PropertyInfo> plist;
+		node->get_property_list(&plist);
+		for (const PropertyInfo &E : plist) {
+			if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringName(script)) {
+				continue;
+			}
+			state.properties.push_back(_capture_property(p_root, E.name, node->get(E.name)));
+		}
+		reset_state.push_back(state);
+
+		// Only nodes that are part of the scene are restored, not ones added at runtime.
+		for (int i = 0; i < node->get_child_count(); i++) {
+			Node *child = node->get_child(i);
+			if (child->get_owner() == p_root) {
+				stack.push_back(child);
+			}
+		}
+	}
+
+	reset_state_captured = true;
+}
+
+NodePool::PropertyResetState NodePool::_capture_property(Node *p_root, const StringName &p_name, const Variant &p_value) const {
+	PropertyResetState property;
+	property.name = p_name;
+	property.value = p_value;
+
+	// Values referring to the captured instance itself must be remapped to each recycled instance.
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			Node *node = Object::cast_to<Node>(p_value.get_validated_object());
+			if (node && (node == p_root || p_root->is_ancestor_of(node))) {
+				property.kind = PropertyResetState::KIND_NODE;
+				property.value = p_root->get_path_to(node);
+				break;
+			}
+
+			Ref<Resource> res = p_value;
+			if (res.is_valid() && res->is_local_to_scene()) {
+				// Copied right away, before the captured instance starts changing its own copy.
+				HashMap<Ref<Resource>, Ref<Resource>> remap_cache;
+				property.kind = PropertyResetState::KIND_LOCAL_RESOURCE;
+				property.value = res->duplicate_for_local_scene(p_root, remap_cache);
+			}
+		} break;
+		case Variant::ARRAY: {
+			// Containers are shared by reference, keep a private copy.
+			Array array = p_value.duplicate(true);
+			for (int i = 0; i < array.size(); i++) {
+				Node *node = Object::cast_to<Node>(array[i].get_validated_object());
+				if (node && (node == p_root || p_root->is_ancestor_of(node))) {
+					property.node_indices.push_back(i);
+					property.node_paths.push_back(p_root->get_path_to(node));
+					array[i] = Variant(); // Keeps the array type, unlike storing the path here.
+				}
+			}
+
+			if (!property.node_indices.is_empty()) {
+				property.kind = PropertyResetState::KIND_NODE_ARRAY;
+			}
+			property.value = array;
+		} break;
+		case Variant::DICTIONARY: {
+			property.value = p_value.duplicate(true);
+		} break;
+		default: {
+		}
+	}
+
+	return property;
+}
+
+Variant NodePool::_restore_property(Node *p_root, const PropertyResetState &p_property, HashMap<Ref<Resource>, Ref<Resource>> &p_local_resources) const {
+	switch (p_property.kind) {
+		case PropertyResetState::KIND_VALUE: {
+			if (p_property.value.get_type() == Variant::ARRAY || p_property.value.get_type() == Variant::DICTIONARY) {
+				return p_property.value.duplicate(true);
+			}
+			return p_property.value;
+		}
+		case PropertyResetState::KIND_NODE: {
+			return p_root->get_node_or_null(p_property.value);
+		}
+		case PropertyResetState::KIND_NODE_ARRAY: {
+			Array array = p_property.value.duplicate(true);
+			for (uint32_t i = 0; i < p_property.node_indices.size(); i++) {
+				array[p_property.node_indices[i]] = p_root->get_node_or_null(p_property.node_paths[i]);
+			}
+			return array;
+		}
+		case PropertyResetState::KIND_LOCAL_RESOURCE: {
+			const Ref<Resource> res = p_property.value;
+			HashMap<Ref<Resource>, Ref<Resource>>::Iterator E = p_local_resources.find(res);
+			if (E) {
+				return E->value; // Shared by several properties, like in a new instance.
+			}
+			Ref<Resource> local_dupe = res->duplicate_for_local_scene(p_root, p_local_resources);
+			p_local_resources[res] = local_dupe;
+			return local_dupe;
+		}
+	}
+	return Variant();
+}
+
+void NodePool::_get_connections(Node *p_root, List<Object::Connection> *r_connections) const {
+	for (const NodeResetState &state : reset_state) {
+		Node *node = p_root->get_node_or_null(state.path);
+		if (node) {
+			node->get_all_signal_connections(r_connections);
+			node->get_signals_connected_to_this(r_connections);
+		}
+	}
+}
+
+void NodePool::_reset_node(Node *p_root, const RBSet<Object::Connection> &p_acquired_connections) {
+	HashMap<Ref<Resource>, Ref<Resource>> local_resources;
+
+	for (const NodeResetState &state : reset_state) {
+		Node *node = p_root->get_node_or_null(state.path);
+		if (!node) {
+			continue;
+		}
+
+		List<Node::GroupInfo> groups;
+		node->get_groups(&groups);
+		for (const Node::GroupInfo &gi : groups) {
+			if (!gi.persistent) {
+				node->remove_from_group(gi.name);
+			}
+		}
+
+		for (const PropertyResetState &property : state.properties) {
+			node->set(property.name, _restore_property(p_root, property, local_resources));
+		}
+	}
+
+	// Same as after instantiating a scene, setup may be required for the resources to work properly.
+	for (KeyValue<Ref<Resource>, Ref<Resource>> &E : local_resources) {
+		if (E.value->get_local_scene() == p_root) {
+			E.value->setup_local_to_scene();
+		}
+	}
+
+	// Done after restoring properties, so connections the nodes make to their own resources are back to how they were.
+	// Only connections made while the node was in use are removed, the ones it had when acquired (saved with the scene,
+	// or made by the nodes themselves) are kept.
+	List<Object::Connection> connections;
+	_get_connections(p_root, &connections);
+	for (const Object::Connection &c : connections) {
+		if ((c.flags & Object::CONNECT_PERSIST) || p_acquired_connections.has(c)) {
+			continue;
+		}
+		Object *source = c.signal.get_object();
+		if (source && source->is_connected(c.signal.get_name(), c.callable)) {
+			source->disconnect(c.signal.get_name(), c.callable);
+		}
+	}
+}
+
+void NodePool::_prune_issued() {
+	// Acquired nodes may be freed instead of released. Forget them from time to time, so they don't pile up.
+	if (issued.size() < issued_prune_size) {
+		return;
+	}
+
+	LocalVector<ObjectID> freed;
+	for (const KeyValue<ObjectID, RBSet<Object::Connection>> &E : issued) {
+		if (!ObjectDB::get_instance(E.key)) {
+			freed.push_back(E.key);
+		}
+	}
+	for (const ObjectID &id : freed) {
+		issued.erase(id);
+	}
+
+	issued_prune_size = MAX(64u, issued.size() * 2);
+}
+
+void NodePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+	scene = p_scene;
+	reset_state.clear();
+	reset_state_captured = false;
+}
+
+Ref<PackedScene> NodePool::get_scene() const {
+	return scene;
+}
+
+void NodePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+	if (max_size > 0) {
+		while ((int)available.size() > max_size) {
+			Node *node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+			available.resize(available.size() - 1);
+			if (node) {
+				memdelete(node);
+			}
+		}
+	}
+}
+
+int NodePool::get_max_size() const {
+	return max_size;
+}
+
+Node *NodePool::acquire() {
+	Node *node = nullptr;
+	while (!node && !available.is_empty()) {
+		node = ObjectDB::get_instance<Node>(available[available.size() - 1]);
+		available.resize(available.size() - 1);
+		if (node && node->is_queued_for_deletion()) {
+			node = nullptr; // Freed by something else while in the pool.
+		}
+	}
+
+	if (node) {
+		// Pooled nodes may have been inside the tree already, make sure they get _ready() again like a new instance.
+		node->request_ready();
+	} else {
+		node = _instantiate();
+		ERR_FAIL_NULL_V(node, nullptr);
+	}
+
+	_prune_issued();
+	RBSet<Object::Connection> &acquired_connections = issued[node->get_instance_id()];
+	List<Object::Connection> connections;
+	_get_connections(node, &connections);
+	for (const Object::Connection &c : connections) {
+		acquired_connections.insert(c);
+	}
+	return node;
+}
+
+void NodePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	const ObjectID id = p_node->get_instance_id();
+	ERR_FAIL_COND_MSG(!issued.has(id), vformat("Node '%s' was not acquired from this NodePool.", p_node->get_name()));
+	if (p_node->is_queued_for_deletion()) {
+		// It will be freed at the end of the frame, it can't be pooled anymore.
+		issued.erase(id);
+		ERR_FAIL_MSG(vformat("Can't release node '%s' because it is queued for deletion.", p_node->get_name()));
+	}
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+		ERR_FAIL_COND_MSG(p_node->get_parent(), vformat("Can't release node '%s' while its parent is busy. Consider using `release.call_deferred(node)` instead.", p_node->get_name()));
+	}
+	const RBSet<Object::Connection> acquired_connections = issued[id];
+	issued.erase(id);
+
+	if (max_size > 0 && (int)available.size() >= max_size) {
+		memdelete(p_node);
+		return;
+	}
+
+	_reset_node(p_node, acquired_connections);
+	available.push_back(id);
+}
+
+void NodePool::prewarm(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	int target = p_count;
+	if (max_size > 0) {
+		target = MIN(target, max_size);
+	}
+	while ((int)available.size() < target) {
+		Node *node = _instantiate();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+	}
+}
+
+void NodePool::clear() {
+	for (const ObjectID &id : available) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+	available.clear();
+	issued.clear();
+	issued_prune_size = 0;
+}
+
+int NodePool::get_available_count() const {
+	int count = 0;
+	for (const ObjectID &id : available) {
+		if (ObjectDB::get_instance(id)) {
+			count++;
+		}
+	}
+	return count;
+}
+
+void NodePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &NodePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &NodePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &NodePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &NodePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &NodePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &NodePool::release);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &NodePool::prewarm);
+	ClassDB::bind_method(D_METHOD("clear"), &NodePool::clear);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &NodePool::get_available_count);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+NodePool::~NodePool() {
+	clear();
+}
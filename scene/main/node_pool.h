@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  node_pool.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/resources/packed_scene.h"
+
+class NodePool : public RefCounted {
+	GDCLASS(NodePool, RefCounted);
+
+	// Stored value of one property, captured from a fresh instance.
+	struct PropertyResetState {
+		enum Kind {
+			KIND_VALUE,
+			KIND_NODE, // A node of the scene, stored as its path from the root.
+			KIND_NODE_ARRAY, // An array holding nodes of the scene, which are stored as their paths from the root.
+			KIND_LOCAL_RESOURCE, // A resource local to the scene, duplicated for each instance.
+		};
+
+		StringName name;
+		Kind kind = KIND_VALUE;
+		Variant value;
+		// For KIND_NODE_ARRAY, the elements holding nodes of the scene, which are left empty in the value.
+		LocalVector<int> node_indices;
+		LocalVector<NodePath> node_paths;
+	};
+
+	// Stored property values of one node of the scene.
+	struct NodeResetState {
+		NodePath path;
+		LocalVector<PropertyResetState> properties;
+	};
+
+	Ref<PackedScene> scene;
+	int max_size = 0;
+
+	// Nodes are kept by ID, in case they get freed by something else while in the pool.
+	LocalVector<ObjectID> available;
+	// Acquired nodes, with the connections they had when they were acquired.
+	HashMap<ObjectID, RBSet<Object::Connection>> issued;
+	uint32_t issued_prune_size = 0;
+
+	bool reset_state_captured = false;
+	LocalVector<NodeResetState> reset_state;
+
+	Node *_instantiate();
+	void _capture_reset_state(Node *p_root);
+	PropertyResetState _capture_property(Node *p_root, const StringName &p_name, const Variant &p_value) const;
+	Variant _restore_property(Node *p_root, const PropertyResetState &p_property, HashMap<Ref<Resource>, Ref<Resource>> &p_local_resources) const;
+	void _get_connections(Node *p_root, List<Object::Connection> *r_connections) const;
+	void _reset_node(Node *p_root, const RBSet<Object::Connection> &p_acquired_connections);
+	void _prune_issued();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_size(int p_max_size);
+	int get_max_size() const;
+
+	Node *acquire();
+	void release(Node *p_node);
+	void prewarm(int p_count);
+	void clear();
+
+	int get_available_count() const;
+
+	~NodePool();
+};
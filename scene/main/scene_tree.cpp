@@ -171,7 +171,14 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 		E = group_map.insert(p_group, Group());
 	}
 
+	// The node keeps its own index in the group, so no linear search is needed here or on removal.
+	Node::GroupData *gd = p_node->data.grouped.getptr(p_group);
+	ERR_FAIL_NULL_V_MSG(gd, &E->value, "Node must register the group before adding itself to it: " + p_group + ".");
+#ifdef DEV_ENABLED
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
+#endif
+
+	gd->index = E->value.nodes.size();
 	E->value.nodes.push_back(p_node);
 	E->value.changed = true;
 	return &E->value;
@@ -183,8 +190,25 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	Node::GroupData *gd = p_node->data.grouped.getptr(p_group);
+	ERR_FAIL_NULL(gd);
+
+	Vector<Node *> &nodes = E->value.nodes;
+	const uint32_t index = gd->index;
+	ERR_FAIL_UNSIGNED_INDEX(index, (uint32_t)nodes.size());
+	ERR_FAIL_COND(nodes[index] != p_node);
+
+	// Swap-remove, tree order is restored lazily by _update_group_order() when it's needed.
+	const uint32_t last = nodes.size() - 1;
+	if (index != last) {
+		Node *moved = nodes[last];
+		nodes.write[index] = moved;
+		moved->data.grouped.getptr(p_group)->index = index;
+		E->value.changed = true;
+	}
+	nodes.resize(last);
+
+	if (nodes.is_empty()) {
 		group_map.remove(E);
 	}
 }
@@ -320,7 +344,7 @@ void SceneTree::_flush_ugc() {
 	ugc_locked = false;
 }
 
-void SceneTree::_update_group_order(Group &g) {
+void SceneTree::_update_group_order(const StringName &p_group, Group &g) {
 	if (!g.changed) {
 		return;
 	}
@@ -334,6 +358,10 @@ void SceneTree::_update_group_order(Group &g) {
 	SortArray<Node *, Node::Comparator> node_sort;
 	node_sort.sort(gr_nodes, gr_node_count);
 
+	for (int i = 0; i < gr_node_count; i++) {
+		gr_nodes[i]->data.grouped.getptr(p_group)->index = i;
+	}
+
 	g.changed = false;
 }
 
@@ -372,7 +400,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 		nodes_copy = g.nodes;
 	}
 
@@ -443,7 +471,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 
 		nodes_copy = g.nodes;
 	}
@@ -506,7 +534,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 
 		nodes_copy = g.nodes;
 	}
@@ -831,7 +859,7 @@ void SceneTree::process_tweens(double p_delta, bool p_physics) {
 }
 
 void SceneTree::finalize() {
-	_flush_delete_queue();
+	_flush_delete_queue(true);
 
 	_flush_ugc();
 
@@ -843,7 +871,7 @@ void SceneTree::finalize() {
 
 		// In case deletion of some objects was queued when destructing the `root`.
 		// E.g. if `queue_free()` was called for some node outside the tree when handling NOTIFICATION_PREDELETE for some node in the tree.
-		_flush_delete_queue();
+		_flush_delete_queue(true);
 	}
 
 	MainLoop::finalize();
@@ -1133,15 +1161,12 @@ bool SceneTree::is_suspended() const {
 	return suspended;
 }
 
-void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
-	// When reading this function, keep in mind that this code must work in a way where
-	// if any node is removed, this needs to continue working.
-
+Vector<Node *> SceneTree::_begin_process_group(ProcessGroup *p_group, bool p_physics) {
 	p_group->call_queue.flush(); // Flush messages before processing.
 
 	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
 	if (nodes.is_empty()) {
-		return;
+		return Vector<Node *>();
 	}
 
 	if (p_physics) {
@@ -1157,13 +1182,12 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	}
 
 	// Make a copy, so if nodes are added/removed from process, this does not break
-	Vector<Node *> nodes_copy = nodes;
-
-	uint32_t node_count = nodes_copy.size();
-	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+	return nodes;
+}
 
-	for (uint32_t i = 0; i < node_count; i++) {
-		Node *n = nodes_ptr[i];
+void SceneTree::_process_group_nodes(Node *const *p_nodes, uint32_t p_count, bool p_physics) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		Node *n = p_nodes[i];
 		if (nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
 			// Keep in mind removals can only happen on the main thread.
@@ -1190,17 +1214,98 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			}
 		}
 	}
+}
+
+void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
+	// When reading this function, keep in mind that this code must work in a way where
+	// if any node is removed, this needs to continue working.
+
+	Vector<Node *> nodes_copy = _begin_process_group(p_group, p_physics);
+	if (nodes_copy.is_empty()) {
+		return;
+	}
+
+	_process_group_nodes(nodes_copy.ptr(), nodes_copy.size(), p_physics);
 
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+	ThreadedProcessTask &task = local_process_tasks[p_index];
+	ProcessGroup *pg = local_process_group_cache[task.work_index];
+	const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+
+	Node::current_process_thread_group = pg->owner;
+	if (local_process_work[task.work_index].parallel) {
+		// Messages are flushed by the calling thread, before and after all the tasks of the group are done.
+		_process_group_nodes(pg->split_nodes.ptr() + task.from, task.to - task.from, p_physics);
+	} else {
+		_process_group(pg, p_physics);
+	}
 	Node::current_process_thread_group = nullptr;
+
+	task.elapsed_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
+}
+
+struct ThreadedProcessTaskSort {
+	_FORCE_INLINE_ bool operator()(const SceneTree::ThreadedProcessTask &p_left, const SceneTree::ThreadedProcessTask &p_right) const {
+		if (p_left.cost_usec != p_right.cost_usec) {
+			return p_left.cost_usec > p_right.cost_usec;
+		}
+		if (p_left.work_index != p_right.work_index) {
+			return p_left.work_index < p_right.work_index;
+		}
+		return p_left.from < p_right.from;
+	}
+};
+
+void SceneTree::plan_threaded_process_tasks(const LocalVector<ThreadedProcessWork> &p_work, uint32_t p_thread_count, LocalVector<ThreadedProcessTask> &r_tasks) {
+	r_tasks.clear();
+
+	const uint32_t thread_count = MAX(p_thread_count, 1u);
+	// A couple of tasks per thread, so the ones picked up last don't leave the other threads idle for long.
+	const uint32_t max_tasks = thread_count * 2;
+
+	uint64_t total_cost_usec = 0;
+	for (const ThreadedProcessWork &work : p_work) {
+		total_cost_usec += work.cost_usec;
+	}
+	const uint64_t task_cost_usec = total_cost_usec / max_tasks;
+
+	for (uint32_t i = 0; i < p_work.size(); i++) {
+		const ThreadedProcessWork &work = p_work[i];
+		uint32_t task_count = 1;
+		if (work.parallel) {
+			if (work.node_count == 0) {
+				continue;
+			}
+			if (work.cost_usec == 0 || task_cost_usec == 0) {
+				// Not measured yet, spread it over all threads.
+				task_count = thread_count;
+			} else {
+				task_count = (uint32_t)MIN((work.cost_usec + task_cost_usec - 1) / task_cost_usec, (uint64_t)max_tasks);
+			}
+			task_count = CLAMP(task_count, 1u, MAX(MIN(max_tasks, work.node_count / MIN_NODES_PER_PROCESS_TASK), 1u));
+		}
+
+		for (uint32_t j = 0; j < task_count; j++) {
+			ThreadedProcessTask task;
+			task.work_index = i;
+			task.from = work.parallel ? (uint32_t)((uint64_t)work.node_count * j / task_count) : 0;
+			task.to = work.parallel ? (uint32_t)((uint64_t)work.node_count * (j + 1) / task_count) : work.node_count;
+			task.cost_usec = work.cost_usec / task_count;
+			r_tasks.push_back(task);
+		}
+	}
+
+	// Workers take tasks in order, so starting with the most expensive ones shortens the time until all of them are done.
+	r_tasks.sort_custom<ThreadedProcessTaskSort>();
 }
 
 void SceneTree::_process(bool p_physics) {
+	// Accumulated over the orders of threaded groups processed below.
+	(p_physics ? physics_process_critical_path_usec : process_critical_path_usec) = 0;
+
 	if (process_groups_dirty) {
 		{
 			// First, remove dirty groups.
@@ -1269,8 +1374,7 @@ void SceneTree::_process(bool p_physics) {
 				}
 
 				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					_process_threaded_groups(p_physics);
 				}
 			}
 
@@ -1318,6 +1422,55 @@ void SceneTree::_process(bool p_physics) {
 	}
 }
 
+void SceneTree::_process_threaded_groups(bool p_physics) {
+	const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+
+	local_process_work.clear();
+	for (ProcessGroup *pg : local_process_group_cache) {
+		ThreadedProcessWork work;
+		work.cost_usec = p_physics ? pg->physics_process_usec : pg->process_usec;
+		work.parallel = pg->owner->data.process_thread_group_parallel;
+		if (work.parallel) {
+			// Sort and copy the nodes once, so each task can take a range of them.
+			Node::current_process_thread_group = pg->owner;
+			pg->split_nodes = _begin_process_group(pg, p_physics);
+			Node::current_process_thread_group = nullptr;
+			work.node_count = pg->split_nodes.size();
+		} else {
+			work.node_count = (p_physics ? pg->physics_nodes : pg->nodes).size();
+		}
+		local_process_work.push_back(work);
+	}
+
+	plan_threaded_process_tasks(local_process_work, WorkerThreadPool::get_singleton()->get_thread_count(), local_process_tasks);
+
+	if (!local_process_tasks.is_empty()) {
+		WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_tasks.size(), -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+	}
+
+	for (ProcessGroup *pg : local_process_group_cache) {
+		(p_physics ? pg->physics_process_usec : pg->process_usec) = 0;
+	}
+	for (const ThreadedProcessTask &task : local_process_tasks) {
+		ProcessGroup *pg = local_process_group_cache[task.work_index];
+		(p_physics ? pg->physics_process_usec : pg->process_usec) += task.elapsed_usec;
+	}
+
+	for (uint32_t i = 0; i < local_process_group_cache.size(); i++) {
+		if (!local_process_work[i].parallel) {
+			continue;
+		}
+		ProcessGroup *pg = local_process_group_cache[i];
+		Node::current_process_thread_group = pg->owner;
+		pg->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+		Node::current_process_thread_group = nullptr;
+		pg->split_nodes.clear();
+	}
+
+	(p_physics ? physics_process_critical_path_usec : process_critical_path_usec) += OS::get_singleton()->get_ticks_usec() - begin_usec;
+}
+
 bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
 	int left_order = p_left->owner ? p_left->owner->data.process_thread_group_order : 0;
 	int right_order = p_right->owner ? p_right->owner->data.process_thread_group_order : 0;
@@ -1400,7 +1553,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 
 		//copy, so copy on write happens in case something is removed from process while being called
 		//performance is not lost because only if something is added/removed the vector is copied.
@@ -1519,7 +1672,7 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 		return ret;
 	}
 
-	_update_group_order(E->value); //update order just in case
+	_update_group_order(p_group, E->value); //update order just in case
 	int nc = E->value.nodes.size();
 	if (nc == 0) {
 		return ret;
@@ -1557,7 +1710,7 @@ Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 		return nullptr; // No group.
 	}
 
-	_update_group_order(E->value); // Update order just in case.
+	_update_group_order(p_group, E->value); // Update order just in case.
 
 	if (E->value.nodes.is_empty()) {
 		return nullptr;
@@ -1573,7 +1726,7 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 		return;
 	}
 
-	_update_group_order(E->value); //update order just in case
+	_update_group_order(p_group, E->value); //update order just in case
 	int nc = E->value.nodes.size();
 	if (nc == 0) {
 		return;
@@ -1584,16 +1737,84 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	}
 }
 
-void SceneTree::_flush_delete_queue() {
+void SceneTree::_flush_delete_queue(bool p_ignore_budget) {
 	_THREAD_SAFE_METHOD_
 
+	if (delete_budget_usec == 0 || p_ignore_budget) {
+		while (delete_queue.size()) {
+			Object *obj = ObjectDB::get_instance(delete_queue.front()->get());
+			if (obj) {
+				memdelete(obj);
+			}
+			delete_queue.pop_front();
+		}
+
+		while (_delete_subtree_step()) {
+		}
+		return;
+	}
+
+	if (delete_pending_subtrees_head > 0 && delete_pending_subtrees_head * 2 >= delete_pending_subtrees.size()) {
+		// Drop the destroyed subtrees, so a backlog that never fully drains doesn't grow forever.
+		const uint32_t remaining = delete_pending_subtrees.size() - delete_pending_subtrees_head;
+		for (uint32_t i = 0; i < remaining; i++) {
+			delete_pending_subtrees[i] = delete_pending_subtrees[delete_pending_subtrees_head + i];
+		}
+		delete_pending_subtrees.resize(remaining);
+		delete_pending_subtrees_head = 0;
+	}
+
 	while (delete_queue.size()) {
-		Object *obj = ObjectDB::get_instance(delete_queue.front()->get());
-		if (obj) {
+		const ObjectID id = delete_queue.front()->get();
+		delete_queue.pop_front();
+
+		Object *obj = ObjectDB::get_instance(id);
+		if (!obj) {
+			continue;
+		}
+
+		Node *node = Object::cast_to<Node>(obj);
+		if (node && !node->data.children.is_empty()) {
+			// Leave the tree this frame, as expected from queue_free(), but destroy the subtree incrementally.
+			if (node->data.parent) {
+				node->data.parent->remove_child(node);
+			}
+			delete_pending_subtrees.push_back(id);
+		} else {
 			memdelete(obj);
 		}
-		delete_queue.pop_front();
 	}
+
+	const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	while (OS::get_singleton()->get_ticks_usec() - begin_usec < delete_budget_usec && _delete_subtree_step()) {
+	}
+}
+
+// Destroys one node of the oldest pending subtree, deepest last child first so that
+// each deletion is cheap. Returns false once there is nothing left to delete.
+bool SceneTree::_delete_subtree_step() {
+	while (delete_pending_subtrees_head < delete_pending_subtrees.size()) {
+		Node *node = ObjectDB::get_instance<Node>(delete_pending_subtrees[delete_pending_subtrees_head]);
+		if (!node) {
+			delete_pending_subtrees_head++;
+			continue;
+		}
+
+		if (node->data.children.is_empty()) {
+			delete_pending_subtrees_head++;
+		} else {
+			do {
+				node = node->data.children.last()->value;
+			} while (!node->data.children.is_empty());
+		}
+
+		memdelete(node);
+		return true;
+	}
+
+	delete_pending_subtrees.clear();
+	delete_pending_subtrees_head = 0;
+	return false;
 }
 
 void SceneTree::queue_delete(Object *p_object) {
@@ -2042,6 +2263,8 @@ SceneTree::SceneTree() {
 
 	set_physics_interpolation_enabled(GLOBAL_DEF("physics/common/physics_interpolation", false));
 
+	delete_budget_usec = GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/delete_queue_budget_usec", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), 0);
+
 	// Always disable jitter fix if physics interpolation is enabled -
 	// Jitter fix will interfere with interpolation, and is not necessary
 	// when interpolation is active.
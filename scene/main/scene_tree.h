@@ -87,6 +87,24 @@ class SceneTree : public MainLoop {
 public:
 	typedef void (*IdleCallback)();
 
+	// Threaded process groups of one order, as seen by the scheduler.
+	struct ThreadedProcessWork {
+		uint64_t cost_usec = 0; // Measured on the last frame.
+		uint32_t node_count = 0;
+		bool parallel = false; // Its nodes can be split across threads.
+	};
+
+	// A range of nodes of one group, processed by a single WorkerThreadPool task.
+	struct ThreadedProcessTask {
+		uint32_t work_index = 0;
+		uint32_t from = 0;
+		uint32_t to = 0;
+		uint64_t cost_usec = 0; // Estimated from the last frame.
+		uint64_t elapsed_usec = 0; // Measured when processed.
+	};
+
+	static constexpr uint32_t MIN_NODES_PER_PROCESS_TASK = 32;
+
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
 
@@ -99,6 +117,11 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		// Time spent in the last process/physics process of this group, only measured for threaded groups.
+		uint64_t process_usec = 0;
+		uint64_t physics_process_usec = 0;
+		// Nodes being processed, while the group is split across several threads.
+		Vector<Node *> split_nodes;
 	};
 
 	struct ProcessGroupSort {
@@ -111,6 +134,10 @@ private:
 	bool process_groups_dirty = true;
 	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
 	uint64_t process_last_pass = 1;
+	LocalVector<ThreadedProcessWork> local_process_work;
+	LocalVector<ThreadedProcessTask> local_process_tasks;
+	uint64_t process_critical_path_usec = 0;
+	uint64_t physics_process_critical_path_usec = 0;
 
 	ProcessGroup default_process_group;
 
@@ -184,6 +211,11 @@ private:
 	HashSet<Node *> nodes_removed_on_group_call; // Skip erased nodes.
 
 	List<ObjectID> delete_queue;
+	// With a deletion budget, freed subtrees leave the tree right away but their nodes
+	// are destroyed progressively over the next frames.
+	uint64_t delete_budget_usec = 0;
+	LocalVector<ObjectID> delete_pending_subtrees;
+	uint32_t delete_pending_subtrees_head = 0; // Subtrees before it are already destroyed.
 
 	uint64_t accessibility_upd_per_sec = 0;
 	bool accessibility_force_update = true;
@@ -194,7 +226,7 @@ private:
 	bool ugc_locked = false;
 	void _flush_ugc();
 
-	_FORCE_INLINE_ void _update_group_order(Group &g);
+	_FORCE_INLINE_ void _update_group_order(const StringName &p_group, Group &g);
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -235,8 +267,11 @@ private:
 	Group *add_to_group(const StringName &p_group, Node *p_node);
 	void remove_from_group(const StringName &p_group, Node *p_node);
 
+	Vector<Node *> _begin_process_group(ProcessGroup *p_group, bool p_physics);
+	void _process_group_nodes(Node *const *p_nodes, uint32_t p_count, bool p_physics);
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _process_threaded_groups(bool p_physics);
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -247,7 +282,8 @@ private:
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
-	void _flush_delete_queue();
+	void _flush_delete_queue(bool p_ignore_budget = false);
+	bool _delete_subtree_step();
 	// Optimization.
 	friend class CanvasItem;
 	friend class Node3D;
@@ -299,6 +335,13 @@ public:
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
 
+	// Splits parallel groups by their cost, and orders the tasks longest first.
+	static void plan_threaded_process_tasks(const LocalVector<ThreadedProcessWork> &p_work, uint32_t p_thread_count, LocalVector<ThreadedProcessTask> &r_tasks);
+
+	// Time the last frame spent processing threaded groups, which only parallelism across more groups or nodes can shorten.
+	uint64_t get_process_critical_path_usec() const { return process_critical_path_usec; }
+	uint64_t get_physics_process_critical_path_usec() const { return physics_process_critical_path_usec; }
+
 	void call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount);
 	void notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification);
 	void set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value);
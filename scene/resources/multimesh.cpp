@@ -303,6 +303,16 @@ Color MultiMesh::get_instance_custom_data(int p_instance) const {
 	return RenderingServer::get_singleton()->multimesh_instance_get_custom_data(multimesh, p_instance);
 }
 
+void MultiMesh::set_buffer_range(int p_first_instance, const Vector<float> &p_buffer) {
+	uint32_t stride = transform_format == TRANSFORM_2D ? 8 : 12;
+	stride += use_colors ? 4 : 0;
+	stride += use_custom_data ? 4 : 0;
+	ERR_FAIL_COND_MSG(p_buffer.size() % stride != 0, vformat("Buffer size must be a multiple of the per-instance data size (%d floats).", stride));
+	ERR_FAIL_COND_MSG(p_first_instance < 0 || p_first_instance + int(p_buffer.size() / stride) > instance_count, "Instance range out of bounds. The range must start at or after zero and end at or before `instance_count`.");
+
+	RS::get_singleton()->multimesh_set_buffer_range(multimesh, p_first_instance, p_buffer);
+}
+
 void MultiMesh::reset_instance_physics_interpolation(int p_instance) {
 	ERR_FAIL_INDEX_MSG(p_instance, instance_count, "Instance index out of bounds. Instance index must be less than `instance_count` and greater than or equal to zero.");
 	RenderingServer::get_singleton()->multimesh_instance_reset_physics_interpolation(multimesh, p_instance);
@@ -388,6 +398,7 @@ void MultiMesh::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_buffer"), &MultiMesh::get_buffer);
 	ClassDB::bind_method(D_METHOD("set_buffer", "buffer"), &MultiMesh::set_buffer);
+	ClassDB::bind_method(D_METHOD("set_buffer_range", "first_instance", "buffer"), &MultiMesh::set_buffer_range);
 
 	ClassDB::bind_method(D_METHOD("set_buffer_interpolated", "buffer_curr", "buffer_prev"), &MultiMesh::set_buffer_interpolated);
 
@@ -114,6 +114,8 @@ public:
 	void set_instance_custom_data(int p_instance, const Color &p_custom_data);
 	Color get_instance_custom_data(int p_instance) const;
 
+	void set_buffer_range(int p_first_instance, const Vector<float> &p_buffer);
+
 	void reset_instance_physics_interpolation(int p_instance);
 
 	void set_physics_interpolated(bool p_interpolated);
@@ -86,6 +86,20 @@ void MeshStorage::_multimesh_free(RID p_rid) {
 	multimesh_owner.free(p_rid);
 }
 
+void MeshStorage::_multimesh_allocate_data(RID p_multimesh, int p_instances, RS::MultimeshTransformFormat p_transform_format, bool p_use_colors, bool p_use_custom_data, bool p_use_indirect) {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	multimesh->instances = p_instances;
+	multimesh->stride = (p_transform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12) + (p_use_colors ? 4 : 0) + (p_use_custom_data ? 4 : 0);
+	multimesh->buffer.clear();
+}
+
+int MeshStorage::_multimesh_get_instance_count(RID p_multimesh) const {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL_V(multimesh, 0);
+	return multimesh->instances;
+}
+
 void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) {
 	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL(multimesh);
@@ -94,6 +108,19 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	memcpy(cache_data, p_buffer.ptr(), p_buffer.size() * sizeof(float));
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->stride == 0 || p_buffer.size() % multimesh->stride != 0);
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + p_buffer.size() / multimesh->stride > multimesh->instances);
+
+	// Keep the data around so the CPU side of bulk updates can be measured without a GPU.
+	if (multimesh->buffer.size() != multimesh->instances * multimesh->stride) {
+		multimesh->buffer.resize_initialized(multimesh->instances * multimesh->stride);
+	}
+	memcpy(multimesh->buffer.ptrw() + p_first_instance * multimesh->stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+}
+
 Vector<float> MeshStorage::_multimesh_get_buffer(RID p_multimesh) const {
 	DummyMultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, Vector<float>());
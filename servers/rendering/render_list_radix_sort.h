@@ -0,0 +1,178 @@
+/**************************************************************************/
+/*  render_list_radix_sort.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/sort_array.h"
+
+// Sorts render list elements by their 128-bit sort key, sort_key2 being the most significant half.
+// T needs a `sort` member with `sort_key1` and `sort_key2`, like the surface caches of the scene renderers.
+// This is a stable LSD radix sort on a compact copy of the keys: byte positions that are the same in every key
+// are skipped, and large lists split each pass across the WorkerThreadPool.
+template <typename T>
+class RenderListRadixSort {
+	static constexpr uint32_t DIGIT_BITS = 8;
+	static constexpr uint32_t BUCKET_COUNT = 1 << DIGIT_BITS;
+	static constexpr uint32_t PASS_COUNT = 128 / DIGIT_BITS;
+
+	struct Entry {
+		uint64_t key1;
+		uint64_t key2;
+		T *element;
+	};
+
+	struct PassData {
+		const Entry *src = nullptr;
+		Entry *dst = nullptr;
+		uint32_t count = 0;
+		uint32_t task_count = 0;
+		uint32_t pass = 0;
+	};
+
+	struct SortByKey {
+		_FORCE_INLINE_ bool operator()(const T *A, const T *B) const {
+			return (A->sort.sort_key2 == B->sort.sort_key2) ? (A->sort.sort_key1 < B->sort.sort_key1) : (A->sort.sort_key2 < B->sort.sort_key2);
+		}
+	};
+
+	LocalVector<Entry> entries;
+	LocalVector<Entry> scratch;
+	LocalVector<uint32_t> histograms; // BUCKET_COUNT counters per task.
+
+	_FORCE_INLINE_ static uint32_t _get_digit(const Entry &p_entry, uint32_t p_pass) {
+		const uint64_t key = p_pass < PASS_COUNT / 2 ? p_entry.key1 : p_entry.key2;
+		return (key >> ((p_pass % (PASS_COUNT / 2)) * DIGIT_BITS)) & (BUCKET_COUNT - 1);
+	}
+
+	void _histogram_task(uint32_t p_task, const PassData *p_data) {
+		uint32_t *histogram = &histograms[p_task * BUCKET_COUNT];
+		memset(histogram, 0, BUCKET_COUNT * sizeof(uint32_t));
+
+		const uint32_t from = uint64_t(p_task) * p_data->count / p_data->task_count;
+		const uint32_t to = uint64_t(p_task + 1) * p_data->count / p_data->task_count;
+		for (uint32_t i = from; i < to; i++) {
+			histogram[_get_digit(p_data->src[i], p_data->pass)]++;
+		}
+	}
+
+	void _scatter_task(uint32_t p_task, const PassData *p_data) {
+		uint32_t *offsets = &histograms[p_task * BUCKET_COUNT];
+
+		const uint32_t from = uint64_t(p_task) * p_data->count / p_data->task_count;
+		const uint32_t to = uint64_t(p_task + 1) * p_data->count / p_data->task_count;
+		for (uint32_t i = from; i < to; i++) {
+			const Entry &entry = p_data->src[i];
+			p_data->dst[offsets[_get_digit(entry, p_data->pass)]++] = entry;
+		}
+	}
+
+public:
+	// Below this, the bucket overhead of a radix sort isn't worth it.
+	static constexpr uint32_t MIN_ELEMENTS = 256;
+	// Minimum amount of elements per task when splitting passes across threads.
+	static constexpr uint32_t THREADED_MIN_ELEMENTS_PER_TASK = 8192;
+
+	void sort(T **p_elements, uint32_t p_count) {
+		if (p_count < MIN_ELEMENTS) {
+			SortArray<T *, SortByKey> sorter;
+			sorter.sort(p_elements, p_count);
+			return;
+		}
+
+		entries.resize(p_count);
+		scratch.resize(p_count);
+
+		const uint64_t first_key1 = p_elements[0]->sort.sort_key1;
+		const uint64_t first_key2 = p_elements[0]->sort.sort_key2;
+		uint64_t varying_key1 = 0;
+		uint64_t varying_key2 = 0;
+
+		for (uint32_t i = 0; i < p_count; i++) {
+			Entry &entry = entries[i];
+			entry.key1 = p_elements[i]->sort.sort_key1;
+			entry.key2 = p_elements[i]->sort.sort_key2;
+			entry.element = p_elements[i];
+			varying_key1 |= entry.key1 ^ first_key1;
+			varying_key2 |= entry.key2 ^ first_key2;
+		}
+
+		PassData pass_data;
+		pass_data.count = p_count;
+		pass_data.task_count = CLAMP(p_count / THREADED_MIN_ELEMENTS_PER_TASK, 1u, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+		histograms.resize(pass_data.task_count * BUCKET_COUNT);
+
+		Entry *src = entries.ptr();
+		Entry *dst = scratch.ptr();
+
+		for (uint32_t pass = 0; pass < PASS_COUNT; pass++) {
+			const uint64_t varying = pass < PASS_COUNT / 2 ? varying_key1 : varying_key2;
+			if (((varying >> ((pass % (PASS_COUNT / 2)) * DIGIT_BITS)) & (BUCKET_COUNT - 1)) == 0) {
+				continue; // Every key has the same digit here, the pass wouldn't move anything.
+			}
+
+			pass_data.src = src;
+			pass_data.dst = dst;
+			pass_data.pass = pass;
+
+			if (pass_data.task_count > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderListRadixSort::_histogram_task, &pass_data, pass_data.task_count, -1, true, SNAME("RenderListSortHistogram"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				_histogram_task(0, &pass_data);
+			}
+
+			// Turn the counts into offsets, ordered by bucket and then by task so the sort stays stable.
+			uint32_t offset = 0;
+			for (uint32_t bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+				for (uint32_t task = 0; task < pass_data.task_count; task++) {
+					uint32_t &counter = histograms[task * BUCKET_COUNT + bucket];
+					const uint32_t count = counter;
+					counter = offset;
+					offset += count;
+				}
+			}
+
+			if (pass_data.task_count > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderListRadixSort::_scatter_task, &pass_data, pass_data.task_count, -1, true, SNAME("RenderListSortScatter"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				_scatter_task(0, &pass_data);
+			}
+
+			SWAP(src, dst);
+		}
+
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_elements[i] = src[i].element;
+		}
+	}
+};
@@ -36,6 +36,8 @@
 #include "servers/rendering/instance_uniforms.h"
 
 class RendererCanvasCull {
+	friend class TestRendererCanvasCullAccessor;
+
 	static void _dependency_changed(Dependency::DependencyChangedNotification p_notification, DependencyTracker *p_tracker);
 	static void _dependency_deleted(const RID &p_dependency, DependencyTracker *p_tracker);
 
@@ -57,8 +59,16 @@ public:
 		Transform2D ysort_xform; // Relative to y-sorted subtree's root item (identity for such root). Its `origin.y` is used for sorting.
 		int ysort_index;
 		int ysort_parent_abs_z_index; // Absolute Z index of parent. Only populated and used when y-sorting.
+		LocalVector<Item *> ysort_order; // Sorted y-sort subtree of the last frame, reused while ysort_children_count stays valid.
 		uint32_t visibility_layer = 0xffffffff;
 
+		// Bounds of the item and all its descendants in the item's own space, used to skip offscreen subtrees.
+		// When an item is dirty, so are all its ancestors.
+		Rect2 subtree_rect;
+		bool subtree_rect_dirty = true;
+		bool subtree_rect_cacheable = false; // False if some bounds in the subtree can change without going through a setter.
+		bool subtree_has_interpolated = false;
+
 		Vector<Item *> child_items;
 
 		struct VisibilityNotifierData {
@@ -209,7 +219,10 @@ private:
 
 	void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int p_z);
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
+	bool _ysort_from_previous_order(LocalVector<Item *> &r_previous, Item **r_items, int p_count);
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
+	void _mark_subtree_rect_dirty(Item *p_item);
+	void _update_subtree_rect(Item *p_item);
 
 	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
 
@@ -982,10 +982,31 @@ void fragment() {
 }
 
 void SceneShaderForwardClustered::set_default_specialization(const ShaderSpecialization &p_specialization) {
+	const ShaderSpecialization old_specialization = default_specialization;
 	default_specialization = p_specialization;
 
+	// The fields set by the default specialization are never changed per draw, so the keys of the specialized
+	// pipelines in use can be moved to the new settings by replacing the bits that changed. They're compiled in the
+	// background right away instead of hitching on their next draw.
+	const uint32_t changed_0 = old_specialization.packed_0 ^ p_specialization.packed_0;
+	const uint32_t changed_1 = old_specialization.packed_1 ^ p_specialization.packed_1;
+	const uint32_t changed_2 = old_specialization.packed_2 ^ p_specialization.packed_2;
+
 	for (SelfList<ShaderData> *E = shader_list.first(); E; E = E->next()) {
-		E->self()->pipeline_hash_map.clear_pipelines();
+		ShaderData *shader_data = E->self();
+		LocalVector<ShaderData::PipelineKey> keys = shader_data->pipeline_hash_map.get_used_keys();
+		shader_data->pipeline_hash_map.clear_pipelines();
+
+		for (ShaderData::PipelineKey &key : keys) {
+			if (key.ubershader) {
+				continue; // Ubershaders don't use the specialization constants.
+			}
+			key.shader_specialization.packed_0 = (key.shader_specialization.packed_0 & ~changed_0) | (p_specialization.packed_0 & changed_0);
+			key.shader_specialization.packed_1 = (key.shader_specialization.packed_1 & ~changed_1) | (p_specialization.packed_1 & changed_1);
+			key.shader_specialization.packed_2 = (key.shader_specialization.packed_2 & ~changed_2) | (p_specialization.packed_2 & changed_2);
+		}
+
+		shader_data->pipeline_hash_map.precompile_pipelines(keys, RS::PIPELINE_SOURCE_SPECIALIZATION);
 	}
 }
 
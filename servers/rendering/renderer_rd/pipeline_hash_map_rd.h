@@ -46,6 +46,7 @@ private:
 	LocalVector<Pair<uint32_t, RID>> compiled_queue;
 	Mutex compiled_queue_mutex;
 	RBSet<uint32_t> compilation_set;
+	LocalVector<Key> used_keys;
 	HashMap<uint32_t, WorkerThreadPool::TaskID> compilation_tasks;
 	Mutex local_mutex;
 
@@ -110,6 +111,7 @@ public:
 
 		// Record the pipeline as submitted, a task can't be started for it again.
 		compilation_set.insert(p_key_hash);
+		used_keys.push_back(p_key);
 
 		if (compilations_mutex != nullptr) {
 			MutexLock compilations_lock(*compilations_mutex);
@@ -202,17 +204,35 @@ public:
 		}
 	}
 
+	// Start compilation of every key in the list in the background. Keys that were already submitted are ignored.
+	void precompile_pipelines(const LocalVector<Key> &p_keys, RS::PipelineSource p_source) {
+		for (const Key &key : p_keys) {
+			compile_pipeline(key, key.hash(), p_source, false);
+		}
+	}
+
+	// Every key that was submitted for compilation since the pipelines were last cleared, in submission order.
+	LocalVector<Key> get_used_keys() {
+		MutexLock local_lock(local_mutex);
+		return used_keys;
+	}
+
 	// Delete all cached pipelines. Can stall if background compilation is in progress.
 	void clear_pipelines() {
 		_wait_for_all_pipelines();
 		_add_new_pipelines_to_map();
 
 		for (KeyValue<uint32_t, RID> entry : hash_map) {
-			RD::get_singleton()->free(entry.value);
+			if (entry.value.is_valid()) {
+				RD::get_singleton()->free(entry.value);
+			}
 		}
 
 		hash_map.clear();
+
+		MutexLock local_lock(local_mutex);
 		compilation_set.clear();
+		used_keys.clear();
 	}
 
 	// Set the external pipeline compilations array to increase the counters on every time a pipeline is compiled.
@@ -1800,6 +1800,31 @@ void MeshStorage::_multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool
 	}
 }
 
+void MeshStorage::_multimesh_mark_range_dirty(MultiMesh *multimesh, int p_from, int p_count, bool p_aabb) {
+	uint32_t from_region = p_from / MULTIMESH_DIRTY_REGION_SIZE;
+	uint32_t to_region = (p_from + p_count - 1) / MULTIMESH_DIRTY_REGION_SIZE;
+#ifdef DEBUG_ENABLED
+	uint32_t data_cache_dirty_region_count = Math::division_round_up(multimesh->instances, MULTIMESH_DIRTY_REGION_SIZE);
+	ERR_FAIL_UNSIGNED_INDEX(to_region, data_cache_dirty_region_count); //bug
+#endif
+	for (uint32_t i = from_region; i <= to_region; i++) {
+		if (!multimesh->data_cache_dirty_regions[i]) {
+			multimesh->data_cache_dirty_regions[i] = true;
+			multimesh->data_cache_dirty_region_count++;
+		}
+	}
+
+	if (p_aabb) {
+		multimesh->aabb_dirty = true;
+	}
+
+	if (!multimesh->dirty) {
+		multimesh->dirty_list = multimesh_dirty_list;
+		multimesh_dirty_list = multimesh;
+		multimesh->dirty = true;
+	}
+}
+
 void MeshStorage::_multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb) {
 	if (p_data) {
 		uint32_t data_cache_dirty_region_count = Math::division_round_up(multimesh->instances, MULTIMESH_DIRTY_REGION_SIZE);
@@ -2141,6 +2166,42 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->instances == 0);
+	ERR_FAIL_COND_MSG(p_buffer.size() % multimesh->stride_cache != 0, vformat("Buffer size must be a multiple of the instance stride (%d floats), got %d instead.", multimesh->stride_cache, p_buffer.size()));
+
+	int instance_count = p_buffer.size() / multimesh->stride_cache;
+	ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + instance_count > multimesh->instances);
+
+	if (instance_count == 0) {
+		return;
+	}
+
+	if (instance_count == multimesh->instances) {
+		// Uploading everything doesn't need the data cache.
+		_multimesh_set_buffer(p_multimesh, p_buffer);
+		return;
+	}
+
+	_multimesh_make_local(multimesh);
+
+	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0) || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
+	if (uses_motion_vectors) {
+		_multimesh_enable_motion_vectors(multimesh);
+	}
+
+	_multimesh_update_motion_vectors_data_cache(multimesh);
+
+	// Copy the whole range at once and flag its dirty regions in a single pass,
+	// they are uploaded with the rest of the dirty regions in _update_dirty_multimeshes().
+	float *w = multimesh->data_cache.ptrw();
+	memcpy(w + (multimesh->motion_vectors_current_offset + p_first_instance) * multimesh->stride_cache, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_multimesh_mark_range_dirty(multimesh, p_first_instance, instance_count, true);
+}
+
 RID MeshStorage::_multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, RID());
@@ -32,6 +32,8 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "modules/modules_enabled.gen.h" // For raycast.
+#include "renderer_scene_occlusion_cull_raster.h"
 #include "rendering_light_culler.h"
 #include "rendering_server_default.h"
 
@@ -2352,13 +2354,28 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	}
 }
 
-bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers) {
-	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
+uint32_t RendererSceneCull::_light_instance_get_shadow_pass_count(Instance *p_instance) const {
+	switch (RSG::light_storage->light_get_type(p_instance->base)) {
+		case RS::LIGHT_OMNI: {
+			if (RSG::light_storage->light_omni_get_shadow_mode(p_instance->base) == RS::LIGHT_OMNI_SHADOW_DUAL_PARABOLOID || !RSG::light_storage->light_instances_can_render_shadow_cube()) {
+				return 2;
+			}
+			return 6;
+		}
+		case RS::LIGHT_SPOT: {
+			return 1;
+		}
+		default: {
+			return 0;
+		}
+	}
+}
 
+void RendererSceneCull::_light_instance_setup_shadow_passes(Instance *p_instance, ShadowCullPass *r_passes) {
 	Transform3D light_transform = p_instance->transform;
 	light_transform.orthonormalize(); //scale does not count on lights
 
-	bool animated_material_found = false;
+	real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 
 	switch (RSG::light_storage->light_get_type(p_instance->base)) {
 		case RS::LIGHT_DIRECTIONAL: {
@@ -2367,15 +2384,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			RS::LightOmniShadowMode shadow_mode = RSG::light_storage->light_omni_get_shadow_mode(p_instance->base);
 
 			if (shadow_mode == RS::LIGHT_OMNI_SHADOW_DUAL_PARABOLOID || !RSG::light_storage->light_instances_can_render_shadow_cube()) {
-				if (max_shadows_used + 2 > MAX_UPDATE_SHADOWS) {
-					return true;
-				}
 				for (int i = 0; i < 2; i++) {
 					//using this one ensures that raster deferred will have it
-					RENDER_TIMESTAMP("Cull OmniLight3D Shadow Paraboloid, Half " + itos(i));
-
-					real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
-
 					real_t z = i == 0 ? -1 : 1;
 					Vector<Plane> planes;
 					planes.resize(6);
@@ -2386,66 +2396,20 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
 					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
 
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
-
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
-
-					RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, i, 0);
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
+					ShadowCullPass &pass = r_passes[i];
+					pass.light = p_instance;
+					pass.pass = i;
+					pass.projection = Projection();
+					pass.transform = light_transform;
+					pass.radius = radius;
+					pass.planes = planes;
 				}
 			} else { //shadow cube
-
-				if (max_shadows_used + 6 > MAX_UPDATE_SHADOWS) {
-					return true;
-				}
-
-				real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 				real_t z_near = MIN(0.025f, radius);
 				Projection cm;
 				cm.set_perspective(90, 1, z_near, radius);
 
 				for (int i = 0; i < 6; i++) {
-					RENDER_TIMESTAMP("Cull OmniLight3D Shadow Cube, Side " + itos(i));
 					//using this one ensures that raster deferred will have it
 
 					static const Vector3 view_normals[6] = {
@@ -2467,123 +2431,103 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 					Transform3D xform = light_transform * Transform3D().looking_at(view_normals[i], view_up[i]);
 
-					Vector<Plane> planes = cm.get_projection_planes(xform);
-
-					instance_shadow_cull_result.clear();
-
-					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
-
-					struct CullConvex {
-						PagedArray<Instance *> *result;
-						_FORCE_INLINE_ bool operator()(void *p_data) {
-							Instance *p_instance = (Instance *)p_data;
-							result->push_back(p_instance);
-							return false;
-						}
-					};
-
-					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
-
-					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
-
-					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
-
-					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
-					}
-
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
-						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
-							continue;
-						} else {
-							if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-								animated_material_found = true;
-							}
-							if (instance->mesh_instance.is_valid()) {
-								RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-							}
-						}
-
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
-					}
-
-					RSG::mesh_storage->update_mesh_instances();
-					RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, xform, radius, 0, i, 0);
-
-					shadow_data.light = light->instance;
-					shadow_data.pass = i;
+					ShadowCullPass &pass = r_passes[i];
+					pass.light = p_instance;
+					pass.pass = i;
+					pass.projection = cm;
+					pass.transform = xform;
+					pass.radius = radius;
+					pass.planes = cm.get_projection_planes(xform);
 				}
-
-				//restore the regular DP matrix
-				//RSG::light_storage->light_instance_set_shadow_transform(light->instance, Projection(), light_transform, radius, 0, 0, 0);
 			}
 
 		} break;
 		case RS::LIGHT_SPOT: {
-			RENDER_TIMESTAMP("Cull SpotLight3D Shadow");
-
-			if (max_shadows_used + 1 > MAX_UPDATE_SHADOWS) {
-				return true;
-			}
-
-			real_t radius = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_RANGE);
 			real_t angle = RSG::light_storage->light_get_param(p_instance->base, RS::LIGHT_PARAM_SPOT_ANGLE);
 			real_t z_near = MIN(0.025f, radius);
 
 			Projection cm;
 			cm.set_perspective(angle * 2.0, 1.0, z_near, radius);
 
-			Vector<Plane> planes = cm.get_projection_planes(light_transform);
+			ShadowCullPass &pass = r_passes[0];
+			pass.light = p_instance;
+			pass.pass = 0;
+			pass.projection = cm;
+			pass.transform = light_transform;
+			pass.radius = radius;
+			pass.planes = cm.get_projection_planes(light_transform);
 
-			instance_shadow_cull_result.clear();
+		} break;
+	}
+}
 
-			Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
+void RendererSceneCull::_shadow_cull_pass(Scenario *p_scenario, ShadowCullPass &r_pass) {
+	r_pass.instances.clear();
 
-			struct CullConvex {
-				PagedArray<Instance *> *result;
-				_FORCE_INLINE_ bool operator()(void *p_data) {
-					Instance *p_instance = (Instance *)p_data;
-					result->push_back(p_instance);
-					return false;
-				}
-			};
+	Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&r_pass.planes[0], r_pass.planes.size());
 
-			CullConvex cull_convex;
-			cull_convex.result = &instance_shadow_cull_result;
+	struct CullConvex {
+		PagedArray<Instance *> *result;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			Instance *p_instance = (Instance *)p_data;
+			result->push_back(p_instance);
+			return false;
+		}
+	};
 
-			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
+	CullConvex cull_convex;
+	cull_convex.result = &r_pass.instances;
 
-			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+	p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(r_pass.planes.ptr(), r_pass.planes.size(), points.ptr(), points.size(), cull_convex);
+}
 
-			if (!light->is_shadow_update_full()) {
-				light_culler->cull_regular_light(instance_shadow_cull_result);
-			}
+void RendererSceneCull::_shadow_cull_pass_threaded(uint32_t p_index, ShadowCullData *p_data) {
+	_shadow_cull_pass(p_data->scenario, p_data->passes[p_index]);
+}
 
-			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-				Instance *instance = instance_shadow_cull_result[j];
-				if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
-					continue;
-				} else {
-					if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
-						animated_material_found = true;
-					}
+bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, ShadowCullPass *p_passes, uint32_t p_pass_count, uint32_t p_first_shadow, uint32_t p_visible_layers) {
+	InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
-					if (instance->mesh_instance.is_valid()) {
-						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
-					}
+	bool animated_material_found = false;
+
+	// The caster lists were queried ahead of time, possibly while other lights were being prepared, so the light culler
+	// has to be set up for this light again.
+	if (!light->is_shadow_update_full()) {
+		light_culler->prepare_regular_light(*p_instance);
+	}
+
+	for (uint32_t i = 0; i < p_pass_count; i++) {
+		ShadowCullPass &pass = p_passes[i];
+		RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[p_first_shadow + i];
+
+		if (!light->is_shadow_update_full()) {
+			light_culler->cull_regular_light(pass.instances);
+		}
+
+		for (int j = 0; j < (int)pass.instances.size(); j++) {
+			Instance *instance = pass.instances[j];
+			if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask & RSG::light_storage->light_get_shadow_caster_mask(p_instance->base))) {
+				continue;
+			} else {
+				if (static_cast<InstanceGeometryData *>(instance->base_data)->material_is_animated) {
+					animated_material_found = true;
+				}
+
+				if (instance->mesh_instance.is_valid()) {
+					RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
 				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
 			}
+			shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+		}
 
-			RSG::mesh_storage->update_mesh_instances();
+		RSG::mesh_storage->update_mesh_instances();
 
-			RSG::light_storage->light_instance_set_shadow_transform(light->instance, cm, light_transform, radius, 0, 0, 0);
-			shadow_data.light = light->instance;
-			shadow_data.pass = 0;
+		RSG::light_storage->light_instance_set_shadow_transform(light->instance, pass.projection, pass.transform, pass.radius, 0, pass.pass, 0);
+		shadow_data.light = light->instance;
+		shadow_data.pass = pass.pass;
 
-		} break;
+		pass.instances.clear();
+		pass.planes = Vector<Plane>();
 	}
 
 	return animated_material_found;
@@ -2813,6 +2757,31 @@ void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_d
 	_scene_cull(*cull_data, scene_cull_result_threads[p_thread], cull_from, cull_to);
 }
 
+bool RendererSceneCull::_in_frustum_coherent(const InstanceBounds &p_bounds, const Frustum &p_frustum, uint32_t &r_flags) {
+	uint32_t plane_hint = (r_flags & InstanceData::FLAG_FRUSTUM_PLANE_HINT_MASK) >> InstanceData::FLAG_FRUSTUM_PLANE_HINT_SHIFT;
+	const uint32_t prev_plane_hint = plane_hint;
+	bool in_frustum = p_bounds.in_frustum(p_frustum, plane_hint);
+	if (plane_hint > (InstanceData::FLAG_FRUSTUM_PLANE_HINT_MASK >> InstanceData::FLAG_FRUSTUM_PLANE_HINT_SHIFT)) {
+		plane_hint = 0; // Doesn't fit in the flags.
+	}
+	if (plane_hint != prev_plane_hint) {
+		r_flags = (r_flags & ~InstanceData::FLAG_FRUSTUM_PLANE_HINT_MASK) | (plane_hint << InstanceData::FLAG_FRUSTUM_PLANE_HINT_SHIFT);
+	}
+	return in_frustum;
+}
+
+void RendererSceneCull::_cull_shadow_cascades_batch(const CullData &cull_data, uint64_t p_from, uint32_t p_count, uint32_t *r_masks) {
+	memset(r_masks, 0, p_count * sizeof(uint32_t));
+
+	// Consecutive instances are contiguous within a page, see the batch limits in _scene_cull().
+	const InstanceBounds *bounds = &cull_data.scenario->instance_aabbs[p_from];
+	for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
+		for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
+			InstanceBounds::in_frustum_batch(bounds, p_count, cull_data.cull->shadows[j].cascades[k].frustum, 1u << (j * RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES + k), r_masks);
+		}
+	}
+}
+
 void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to) {
 	uint64_t frame_number = RSG::rasterizer->get_frame_number();
 	float lightmap_probe_update_speed = RSG::light_storage->lightmap_get_probe_capture_update_speed() * RSG::rasterizer->get_frame_delta_time();
@@ -2825,23 +2794,37 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
 	float z_near = cull_data.camera_matrix->get_z_near();
 
+	// Shadow cascade frustums are tested in batches ahead of the per-instance work, one bit per cascade.
+	static_assert(RendererSceneRender::MAX_DIRECTIONAL_LIGHTS * RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES <= 32);
+	uint32_t cascade_masks[InstanceBounds::FRUSTUM_BATCH_SIZE];
+	uint64_t cascade_batch_from = p_from;
+	uint64_t cascade_batch_to = p_from;
+	const uint64_t page_size_mask = instance_aabb_page_pool.get_page_size_mask();
+
 	for (uint64_t i = p_from; i < p_to; i++) {
 		bool mesh_visible = false;
 
+		if (cull_data.cull->shadow_count > 0 && i == cascade_batch_to) {
+			// Batches must not cross a page boundary of the bounds array.
+			cascade_batch_from = i;
+			cascade_batch_to = MIN(MIN(p_to, i + InstanceBounds::FRUSTUM_BATCH_SIZE), (i | page_size_mask) + 1);
+			_cull_shadow_cascades_batch(cull_data, cascade_batch_from, cascade_batch_to - cascade_batch_from, cascade_masks);
+		}
+
 		InstanceData &idata = cull_data.scenario->instance_data[i];
 		uint32_t visibility_flags = idata.flags & (InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE | InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN | InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 		int32_t visibility_check = -1;
 
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
-#define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_CAMERA_FRUSTUM (_in_frustum_coherent(cull_data.scenario->instance_aabbs[i], cull_data.cull->frustum, idata.flags))
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_CAMERA_FRUSTUM && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -3045,7 +3028,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 					continue;
 				}
 				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
-					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
+					if ((cascade_masks[i - cascade_batch_from] & (1u << (j * RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES + k))) && VIS_CHECK) {
 						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
 						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && (LAYER_CHECK & cull_data.cull->shadows[j].caster_mask)) {
@@ -3059,7 +3042,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 #undef HIDDEN_BY_VISIBILITY_CHECKS
 #undef LAYER_CHECK
-#undef IN_FRUSTUM
+#undef IN_CAMERA_FRUSTUM
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
@@ -3297,6 +3280,9 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		}
 
 		// Positional Shadows
+		// Lights are set up one by one, then all their caster queries run at once, then results are consumed in the same order.
+		const uint32_t first_positional_shadow = max_shadows_used;
+
 		for (uint32_t i = 0; i < (uint32_t)scene_cull_result.lights.size(); i++) {
 			Instance *ins = scene_cull_result.lights[i];
 
@@ -3411,17 +3397,53 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 			if (redraw && max_shadows_used < MAX_UPDATE_SHADOWS) {
 				//must redraw!
-				RENDER_TIMESTAMP("> Render Light3D " + itos(i));
-				if (_light_instance_update_shadow(ins, p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect, p_shadow_atlas, scenario, p_screen_mesh_lod_threshold, p_visible_layers)) {
+				uint32_t pass_count = _light_instance_get_shadow_pass_count(ins);
+				if (max_shadows_used + pass_count > MAX_UPDATE_SHADOWS) {
 					light->make_shadow_dirty();
+					continue;
 				}
-				RENDER_TIMESTAMP("< Render Light3D " + itos(i));
+				_light_instance_setup_shadow_passes(ins, &shadow_cull_passes[max_shadows_used]);
+				max_shadows_used += pass_count;
 			} else {
 				if (redraw) {
 					light->make_shadow_dirty();
 				}
 			}
 		}
+
+		const uint32_t positional_shadow_count = max_shadows_used - first_positional_shadow;
+		if (positional_shadow_count > 0) {
+			RENDER_TIMESTAMP("Cull Light3D Shadows");
+
+			if (positional_shadow_count > 1 && scenario->instance_data.size() > thread_cull_threshold) {
+				ShadowCullData shadow_cull_data;
+				shadow_cull_data.scenario = scenario;
+				shadow_cull_data.passes = &shadow_cull_passes[first_positional_shadow];
+
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_shadow_cull_pass_threaded, &shadow_cull_data, positional_shadow_count, -1, true, SNAME("RenderCullShadows"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				for (uint32_t i = first_positional_shadow; i < max_shadows_used; i++) {
+					_shadow_cull_pass(scenario, shadow_cull_passes[i]);
+				}
+			}
+		}
+
+		for (uint32_t i = first_positional_shadow; i < max_shadows_used;) {
+			Instance *ins = shadow_cull_passes[i].light;
+			uint32_t pass_count = 1;
+			while (i + pass_count < max_shadows_used && shadow_cull_passes[i + pass_count].light == ins) {
+				pass_count++;
+			}
+
+			RENDER_TIMESTAMP("> Render Light3D " + itos(i));
+			if (_light_instance_update_shadow(ins, &shadow_cull_passes[i], pass_count, i, p_visible_layers)) {
+				static_cast<InstanceLightData *>(ins->base_data)->make_shadow_dirty();
+			}
+			RENDER_TIMESTAMP("< Render Light3D " + itos(i));
+
+			i += pass_count;
+		}
 	}
 
 	//render SDFGI
@@ -4278,10 +4300,10 @@ RendererSceneCull::RendererSceneCull() {
 	singleton = this;
 
 	instance_cull_result.set_page_pool(&instance_cull_page_pool);
-	instance_shadow_cull_result.set_page_pool(&instance_cull_page_pool);
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		shadow_cull_passes[i].instances.set_page_pool(&instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4298,7 +4320,12 @@ RendererSceneCull::RendererSceneCull() {
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
 	RendererSceneOcclusionCull::HZBuffer::occlusion_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
 
-	dummy_occlusion_culling = memnew(RendererSceneOcclusionCull);
+#ifdef MODULE_RAYCAST_ENABLED
+	// Replaced by RaycastOcclusionCull when the raycast module is initialized.
+	fallback_occlusion_culling = memnew(RendererSceneOcclusionCull);
+#else
+	fallback_occlusion_culling = memnew(RendererSceneOcclusionCullRaster);
+#endif
 
 	light_culler = memnew(RenderingLightCuller);
 
@@ -4309,10 +4336,10 @@ RendererSceneCull::RendererSceneCull() {
 
 RendererSceneCull::~RendererSceneCull() {
 	instance_cull_result.reset();
-	instance_shadow_cull_result.reset();
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		shadow_cull_passes[i].instances.reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
@@ -4324,8 +4351,8 @@ RendererSceneCull::~RendererSceneCull() {
 	}
 	scene_cull_result_threads.clear();
 
-	if (dummy_occlusion_culling) {
-		memdelete(dummy_occlusion_culling);
+	if (fallback_occlusion_culling) {
+		memdelete(fallback_occlusion_culling);
 	}
 
 	if (light_culler) {
@@ -125,7 +125,7 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	RendererSceneOcclusionCull *fallback_occlusion_culling = nullptr;
 
 	/* SCENARIO API */
 
@@ -224,6 +224,52 @@ public:
 
 			return true;
 		}
+		// Same test as above, but starts with the plane that rejected the bounds last time (`r_plane_hint`, one-based, 0 if none).
+		// Instances that stay out of view are usually outside the same plane on the next frame, so they get rejected with a single test.
+		_ALWAYS_INLINE_ bool in_frustum(const Frustum &p_frustum, uint32_t &r_plane_hint) const {
+			uint32_t first = r_plane_hint > 0 && r_plane_hint <= p_frustum.plane_count ? r_plane_hint - 1 : 0;
+
+			for (uint32_t j = 0; j < p_frustum.plane_count; j++) {
+				uint32_t i = j == 0 ? first : (j <= first ? j - 1 : j);
+				Vector3 min(
+						bounds[p_frustum.plane_signs_ptr[i].signs[0]],
+						bounds[p_frustum.plane_signs_ptr[i].signs[1]],
+						bounds[p_frustum.plane_signs_ptr[i].signs[2]]);
+
+				if (p_frustum.planes_ptr[i].distance_to(min) >= 0.0) {
+					r_plane_hint = i + 1;
+					return false;
+				}
+			}
+
+			r_plane_hint = 0;
+			return true;
+		}
+		static constexpr uint32_t FRUSTUM_BATCH_SIZE = 64;
+
+		// Tests up to FRUSTUM_BATCH_SIZE consecutive bounds like in_frustum(), setting `p_mask` in `r_masks` for the ones inside.
+		// Planes are walked in the outer loop and there are no early exits, so the inner loop has no branches and
+		// can be vectorized by the compiler.
+		static void in_frustum_batch(const InstanceBounds *p_bounds, uint32_t p_count, const Frustum &p_frustum, uint32_t p_mask, uint32_t *r_masks) {
+			DEV_ASSERT(p_count <= FRUSTUM_BATCH_SIZE);
+			uint32_t outside[FRUSTUM_BATCH_SIZE] = {};
+
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				const Plane &plane = p_frustum.planes_ptr[i];
+				const uint32_t sx = p_frustum.plane_signs_ptr[i].signs[0];
+				const uint32_t sy = p_frustum.plane_signs_ptr[i].signs[1];
+				const uint32_t sz = p_frustum.plane_signs_ptr[i].signs[2];
+
+				for (uint32_t j = 0; j < p_count; j++) {
+					const real_t *b = p_bounds[j].bounds;
+					outside[j] |= (plane.normal.x * b[sx] + plane.normal.y * b[sy] + plane.normal.z * b[sz] - plane.d) >= 0.0;
+				}
+			}
+
+			for (uint32_t j = 0; j < p_count; j++) {
+				r_masks[j] |= p_mask & (outside[j] - 1);
+			}
+		}
 		_ALWAYS_INLINE_ bool in_aabb(const AABB &p_aabb) const {
 			Vector3 end = p_aabb.position + p_aabb.size;
 
@@ -275,7 +321,9 @@ public:
 			FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN = (1 << 22),
 			FLAG_GEOM_PROJECTOR_SOFTSHADOW_DIRTY = (1 << 23),
 			FLAG_IGNORE_ALL_CULLING = (1 << 24),
+			FLAG_FRUSTUM_PLANE_HINT_MASK = (7 << 25), // 3 bits, plane that last rejected the instance from the camera frustum.
 		};
+		static constexpr uint32_t FLAG_FRUSTUM_PLANE_HINT_SHIFT = 25;
 
 		uint32_t flags = 0;
 		uint32_t layer_mask = 0; //for fast layer-mask discard
@@ -877,7 +925,6 @@ public:
 	PagedArrayPool<RID> rid_cull_page_pool;
 
 	PagedArray<Instance *> instance_cull_result;
-	PagedArray<Instance *> instance_shadow_cull_result;
 
 	struct InstanceCullResult {
 		PagedArray<RenderGeometryInstance *> geometry_instances;
@@ -1005,6 +1052,24 @@ public:
 	RendererSceneRender::RenderShadowData render_shadow_data[MAX_UPDATE_SHADOWS];
 	uint32_t max_shadows_used = 0;
 
+	// Positional light shadow passes, indexed like render_shadow_data. The caster queries of all passes can run in parallel.
+	struct ShadowCullPass {
+		Instance *light = nullptr;
+		uint32_t pass = 0;
+		Projection projection;
+		Transform3D transform;
+		real_t radius = 0;
+		Vector<Plane> planes;
+		PagedArray<Instance *> instances;
+	};
+
+	struct ShadowCullData {
+		Scenario *scenario = nullptr;
+		ShadowCullPass *passes = nullptr;
+	};
+
+	ShadowCullPass shadow_cull_passes[MAX_UPDATE_SHADOWS];
+
 	RendererSceneRender::RenderSDFGIData render_sdfgi_data[SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE];
 	RendererSceneRender::RenderSDFGIUpdateData sdfgi_update_data;
 
@@ -1077,7 +1142,11 @@ public:
 
 	void _light_instance_setup_directional_shadow(int p_shadow_index, Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect);
 
-	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform3D p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, bool p_cam_vaspect, RID p_shadow_atlas, Scenario *p_scenario, float p_screen_mesh_lod_threshold, uint32_t p_visible_layers = 0xFFFFFF);
+	uint32_t _light_instance_get_shadow_pass_count(Instance *p_instance) const;
+	void _light_instance_setup_shadow_passes(Instance *p_instance, ShadowCullPass *r_passes);
+	void _shadow_cull_pass(Scenario *p_scenario, ShadowCullPass &r_pass);
+	void _shadow_cull_pass_threaded(uint32_t p_index, ShadowCullData *p_data);
+	_FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, ShadowCullPass *p_passes, uint32_t p_pass_count, uint32_t p_first_shadow, uint32_t p_visible_layers = 0xFFFFFF);
 
 	RID _render_get_environment(RID p_camera, RID p_scenario);
 	RID _render_get_compositor(RID p_camera, RID p_scenario);
@@ -1147,6 +1216,8 @@ public:
 	};
 
 	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
+	_FORCE_INLINE_ static bool _in_frustum_coherent(const InstanceBounds &p_bounds, const Frustum &p_frustum, uint32_t &r_flags);
+	void _cull_shadow_cascades_batch(const CullData &cull_data, uint64_t p_from, uint32_t p_count, uint32_t *r_masks);
 	void _scene_cull(CullData &cull_data, InstanceCullResult &cull_result, uint64_t p_from, uint64_t p_to);
 	static void _scene_particles_set_view_axis(RID p_particles, const Vector3 &p_axis, const Vector3 &p_up_axis);
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
@@ -0,0 +1,400 @@
+/**************************************************************************/
+/*  renderer_scene_occlusion_cull_raster.cpp                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "renderer_scene_occlusion_cull_raster.h"
+
+#include "core/object/worker_thread_pool.h"
+
+static Rect2 _get_near_plane_rect(const Projection &p_cam_projection) {
+	// Same assumptions as RaycastOcclusionCull: a rectangular projection plane across the z-axis.
+	Size2 half_extents = p_cam_projection.get_viewport_half_extents();
+	Point2 bottom_left = -half_extents * Vector2(p_cam_projection.columns[3][0] * p_cam_projection.columns[3][3] + p_cam_projection.columns[2][0] * p_cam_projection.columns[2][3] + 1, p_cam_projection.columns[3][1] * p_cam_projection.columns[3][3] + p_cam_projection.columns[2][1] * p_cam_projection.columns[2][3] + 1);
+	return Rect2(bottom_left, 2 * half_extents);
+}
+
+void RendererSceneOcclusionCullRaster::RasterHZBuffer::_add_triangle(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	const Size2i &buffer_size = sizes[0];
+	const Vector3 view[3] = { p_a, p_b, p_c };
+
+	Vector2 screen[3];
+	float depth[3];
+	for (int i = 0; i < 3; i++) {
+		Plane projected = p_cam_projection.xform4(Plane(view[i], 1.0));
+		real_t w = projected.d;
+		screen[i] = Vector2((projected.normal.x / w * 0.5f + 0.5f) * buffer_size.x, (projected.normal.y / w * 0.5f + 0.5f) * buffer_size.y);
+		// View depth is affine in screen space for orthogonal projections, its reciprocal is for perspective ones.
+		depth[i] = p_cam_orthogonal ? -view[i].z : 1.0f / -view[i].z;
+	}
+
+	float area = (screen[1] - screen[0]).cross(screen[2] - screen[0]);
+	if (Math::is_zero_approx(area)) {
+		return;
+	}
+
+	// Occluders are double-sided, so flip clockwise triangles instead of discarding them.
+	if (area < 0) {
+		SWAP(screen[1], screen[2]);
+		SWAP(depth[1], depth[2]);
+		area = -area;
+	}
+
+	float min_x = MIN(screen[0].x, MIN(screen[1].x, screen[2].x));
+	float max_x = MAX(screen[0].x, MAX(screen[1].x, screen[2].x));
+	float min_y = MIN(screen[0].y, MIN(screen[1].y, screen[2].y));
+	float max_y = MAX(screen[0].y, MAX(screen[1].y, screen[2].y));
+
+	if (max_x < -1 || max_y < -1 || min_x > buffer_size.x + 1 || min_y > buffer_size.y + 1) {
+		return;
+	}
+
+	Triangle tri;
+	// One extra pixel on each side accounts for jittered pixel centers, the edge functions reject anything outside.
+	tri.min_x = CLAMP((int)Math::floor(min_x) - 1, 0, buffer_size.x - 1);
+	tri.max_x = CLAMP((int)Math::ceil(max_x), 0, buffer_size.x - 1);
+	tri.min_y = CLAMP((int)Math::floor(min_y) - 1, 0, buffer_size.y - 1);
+	tri.max_y = CLAMP((int)Math::ceil(max_y), 0, buffer_size.y - 1);
+
+	float inv_area = 1.0f / area;
+	tri.depth_a = 0.0f;
+	tri.depth_b = 0.0f;
+	tri.depth_c = 0.0f;
+
+	for (int i = 0; i < 3; i++) {
+		// Edge function of the edge opposite to vertex i, normalized so it evaluates to the barycentric weight of i.
+		const Vector2 &from = screen[(i + 1) % 3];
+		const Vector2 &to = screen[(i + 2) % 3];
+		tri.edge_a[i] = (from.y - to.y) * inv_area;
+		tri.edge_b[i] = (to.x - from.x) * inv_area;
+		tri.edge_c[i] = ((to.y - from.y) * from.x - (to.x - from.x) * from.y) * inv_area;
+
+		tri.depth_a += tri.edge_a[i] * depth[i];
+		tri.depth_b += tri.edge_b[i] * depth[i];
+		tri.depth_c += tri.edge_c[i] * depth[i];
+	}
+
+	triangles.push_back(tri);
+}
+
+void RendererSceneOcclusionCullRaster::RasterHZBuffer::_clip_and_add_triangle(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c, const Projection &p_cam_projection, real_t p_z_near, bool p_cam_orthogonal) {
+	const Vector3 in[3] = { p_a, p_b, p_c };
+	Vector3 out[4];
+	int out_count = 0;
+
+	// Clip against the near plane, a triangle becomes at most a quad.
+	for (int i = 0; i < 3; i++) {
+		const Vector3 &current = in[i];
+		const Vector3 &next = in[(i + 1) % 3];
+		bool current_inside = current.z <= -p_z_near;
+		bool next_inside = next.z <= -p_z_near;
+
+		if (current_inside) {
+			out[out_count++] = current;
+		}
+		if (current_inside != next_inside) {
+			real_t t = (-p_z_near - current.z) / (next.z - current.z);
+			out[out_count++] = current.lerp(next, t);
+		}
+	}
+
+	if (out_count < 3) {
+		return;
+	}
+
+	_add_triangle(out[0], out[1], out[2], p_cam_projection, p_cam_orthogonal);
+	if (out_count == 4) {
+		_add_triangle(out[0], out[2], out[3], p_cam_projection, p_cam_orthogonal);
+	}
+}
+
+void RendererSceneOcclusionCullRaster::RasterHZBuffer::_rasterize_band(uint32_t p_band, const RasterThreadData *p_data) {
+	const Size2i &buffer_size = sizes[0];
+	const int from_y = p_band * buffer_size.y / p_data->band_count;
+	const int to_y = (p_band + 1) * buffer_size.y / p_data->band_count;
+	float *depth_buffer = mips[0];
+
+	for (int i = from_y * buffer_size.x; i < to_y * buffer_size.x; i++) {
+		depth_buffer[i] = p_data->z_far;
+	}
+
+	for (const Triangle &tri : triangles) {
+		const int min_y = MAX(tri.min_y, from_y);
+		const int max_y = MIN(tri.max_y, to_y - 1);
+
+		for (int y = min_y; y <= max_y; y++) {
+			float *row = &depth_buffer[y * buffer_size.x];
+			const float py = y + 0.5f + p_data->jitter.y;
+			const float e0 = tri.edge_b[0] * py + tri.edge_c[0];
+			const float e1 = tri.edge_b[1] * py + tri.edge_c[1];
+			const float e2 = tri.edge_b[2] * py + tri.edge_c[2];
+			const float d = tri.depth_b * py + tri.depth_c;
+
+			// Keep the spans branchless so they can be auto-vectorized.
+			if (p_data->orthogonal) {
+				for (int x = tri.min_x; x <= tri.max_x; x++) {
+					const float px = x + 0.5f + p_data->jitter.x;
+					const bool inside = (tri.edge_a[0] * px + e0 >= 0.0f) & (tri.edge_a[1] * px + e1 >= 0.0f) & (tri.edge_a[2] * px + e2 >= 0.0f);
+					const float distance = tri.depth_a * px + d;
+					row[x] = (inside & (distance < row[x])) ? distance : row[x];
+				}
+			} else {
+				const float row_term = 1.0f + row_scale[y];
+				for (int x = tri.min_x; x <= tri.max_x; x++) {
+					const float px = x + 0.5f + p_data->jitter.x;
+					const bool inside = (tri.edge_a[0] * px + e0 >= 0.0f) & (tri.edge_a[1] * px + e1 >= 0.0f) & (tri.edge_a[2] * px + e2 >= 0.0f);
+					// Convert the interpolated reciprocal depth into the distance along the pixel ray, as RaycastOcclusionCull stores.
+					const float distance = Math::sqrt(row_term + column_scale[x]) / (tri.depth_a * px + d);
+					row[x] = (inside & (distance < row[x])) ? distance : row[x];
+				}
+			}
+		}
+	}
+}
+
+void RendererSceneOcclusionCullRaster::RasterHZBuffer::rasterize(const LocalVector<Mesh> &p_meshes, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const Vector2 &p_jitter) {
+	ERR_FAIL_COND(is_empty());
+
+	const Size2i &buffer_size = sizes[0];
+	const real_t z_near = p_cam_projection.get_z_near();
+	const Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+
+	triangles.clear();
+
+	for (const Mesh &mesh : p_meshes) {
+		const Transform3D to_view = cam_inv_transform * mesh.xform;
+
+		view_vertices.resize(mesh.vertex_count);
+		for (uint32_t i = 0; i < mesh.vertex_count; i++) {
+			view_vertices[i] = to_view.xform(mesh.vertices[i]);
+		}
+
+		for (uint32_t i = 0; i + 2 < mesh.index_count; i += 3) {
+			uint32_t a = mesh.indices[i];
+			uint32_t b = mesh.indices[i + 1];
+			uint32_t c = mesh.indices[i + 2];
+			if (a >= mesh.vertex_count || b >= mesh.vertex_count || c >= mesh.vertex_count) {
+				continue;
+			}
+			_clip_and_add_triangle(view_vertices[a], view_vertices[b], view_vertices[c], p_cam_projection, z_near, p_cam_orthogonal);
+		}
+	}
+
+	if (!p_cam_orthogonal) {
+		// Squared slopes of the pixel rays, so the distance along a ray is depth * sqrt(1 + column + row).
+		Rect2 near_rect = _get_near_plane_rect(p_cam_projection);
+		column_scale.resize(buffer_size.x);
+		row_scale.resize(buffer_size.y);
+		for (int x = 0; x < buffer_size.x; x++) {
+			float slope = (near_rect.position.x + (x + 0.5f + p_jitter.x) / buffer_size.x * near_rect.size.x) / z_near;
+			column_scale[x] = slope * slope;
+		}
+		for (int y = 0; y < buffer_size.y; y++) {
+			float slope = (near_rect.position.y + (y + 0.5f + p_jitter.y) / buffer_size.y * near_rect.size.y) / z_near;
+			row_scale[y] = slope * slope;
+		}
+	}
+
+	RasterThreadData td;
+	td.band_count = CLAMP(WorkerThreadPool::get_singleton()->get_thread_count(), 1, buffer_size.y);
+	td.jitter = p_jitter;
+	td.z_far = p_cam_projection.get_z_far() * 1.05f;
+	td.orthogonal = p_cam_orthogonal;
+
+	debug_tex_range = td.z_far;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_rasterize_band, &td, td.band_count, -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	update_mips();
+}
+
+////////////////////////////////////////////////////////
+
+bool RendererSceneOcclusionCullRaster::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RendererSceneOcclusionCullRaster::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RendererSceneOcclusionCullRaster::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RendererSceneOcclusionCullRaster::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+
+	occluder->aabb = AABB();
+	for (int i = 0; i < p_vertices.size(); i++) {
+		if (i == 0) {
+			occluder->aabb.position = p_vertices[i];
+		} else {
+			occluder->aabb.expand_to(p_vertices[i]);
+		}
+	}
+}
+
+void RendererSceneOcclusionCullRaster::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RendererSceneOcclusionCullRaster::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RendererSceneOcclusionCullRaster::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RendererSceneOcclusionCullRaster::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	// Occluders are rasterized from scratch every frame, so there is nothing to rebuild when they move.
+	OccluderInstance &instance = scenario->instances[p_instance];
+	instance.occluder = p_occluder;
+	instance.xform = p_xform;
+	instance.enabled = p_enabled;
+}
+
+void RendererSceneOcclusionCullRaster::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+	scenario->instances.erase(p_instance);
+}
+
+////////////////////////////////////////////////////////
+
+void RendererSceneOcclusionCullRaster::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RendererSceneOcclusionCullRaster::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RendererSceneOcclusionCullRaster::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RendererSceneOcclusionCullRaster::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+Vector2 RendererSceneOcclusionCullRaster::_get_jitter() const {
+	if (!HZBuffer::occlusion_jitter_enabled) {
+		return Vector2();
+	}
+
+	// Same pattern as RaycastOcclusionCull, in pixels: 0.66 half-pixels gives samples at 0, 1/3 and 2/3.
+	static const Vector2 pattern[9] = {
+		Vector2(0, 0),
+		Vector2(-1, -1),
+		Vector2(1, -1),
+		Vector2(-1, 1),
+		Vector2(1, 1),
+		Vector2(-0.5f, -0.5f),
+		Vector2(0.5f, -0.5f),
+		Vector2(-0.5f, 0.5f),
+		Vector2(0.5f, 0.5f),
+	};
+
+	return pattern[Engine::get_singleton()->get_frames_drawn() % 9] * 0.33f;
+}
+
+void RendererSceneOcclusionCullRaster::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || buffer->is_empty()) {
+		return;
+	}
+
+	const Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (!scenario) {
+		return;
+	}
+
+	Vector<Plane> planes = p_cam_projection.get_projection_planes(p_cam_transform);
+	Vector3 endpoints[8];
+	p_cam_projection.get_endpoints(p_cam_transform, endpoints);
+
+	visible_meshes.clear();
+
+	for (const KeyValue<RID, OccluderInstance> &E : scenario->instances) {
+		const OccluderInstance &instance = E.value;
+		if (!instance.enabled) {
+			continue;
+		}
+
+		const Occluder *occluder = occluder_owner.get_or_null(instance.occluder);
+		if (!occluder || occluder->indices.size() < 3) {
+			continue;
+		}
+
+		if (!instance.xform.xform(occluder->aabb).intersects_convex_shape(planes.ptr(), planes.size(), endpoints, 8)) {
+			continue;
+		}
+
+		RasterHZBuffer::Mesh mesh;
+		mesh.vertices = occluder->vertices.ptr();
+		mesh.vertex_count = occluder->vertices.size();
+		mesh.indices = occluder->indices.ptr();
+		mesh.index_count = occluder->indices.size();
+		mesh.xform = instance.xform;
+		visible_meshes.push_back(mesh);
+	}
+
+	buffer->rasterize(visible_meshes, p_cam_transform, p_cam_projection, p_cam_orthogonal, _get_jitter());
+}
+
+RendererSceneOcclusionCull::HZBuffer *RendererSceneOcclusionCullRaster::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RendererSceneOcclusionCullRaster::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
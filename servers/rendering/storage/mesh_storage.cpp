@@ -223,6 +223,28 @@ void RendererMeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<flo
 	_multimesh_set_buffer(p_multimesh, p_buffer);
 }
 
+void RendererMeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_first_instance, const Vector<float> &p_buffer) {
+	MultiMeshInterpolator *mmi = _multimesh_get_interpolator(p_multimesh);
+	if (mmi && mmi->interpolated) {
+		ERR_FAIL_COND(mmi->_stride == 0);
+		ERR_FAIL_COND_MSG(p_buffer.size() % mmi->_stride != 0, vformat("Buffer size must be a multiple of the instance stride (%d floats), got %d instead.", mmi->_stride, p_buffer.size()));
+		ERR_FAIL_COND(p_first_instance < 0 || p_first_instance + p_buffer.size() / mmi->_stride > mmi->_num_instances);
+
+		memcpy(mmi->_data_curr.ptrw() + p_first_instance * mmi->_stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+		_multimesh_add_to_interpolation_lists(p_multimesh, *mmi);
+
+#if defined(DEBUG_ENABLED) && defined(TOOLS_ENABLED)
+		if (!Engine::get_singleton()->is_in_physics_frame()) {
+			PHYSICS_INTERPOLATION_WARNING("MultiMesh interpolation is being triggered from outside physics process, this might lead to issues");
+		}
+#endif
+
+		return;
+	}
+
+	_multimesh_set_buffer_range(p_multimesh, p_first_instance, p_buffer);
+}
+
 RID RendererMeshStorage::multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	return _multimesh_get_command_buffer_rd_rid(p_multimesh);
 }
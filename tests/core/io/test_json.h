@@ -283,6 +283,19 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 				vformat("Parsing valid unicode escape sequence with value `0020` as JSON should return the expected value."));
 	}
 
+	SUBCASE("Escape sequences mixed with unescaped characters") {
+		json.parse(R"("Hello\tworld\u00e9 \"quoted\" text\\")");
+
+		CHECK_MESSAGE(
+				json.get_error_line() == 0,
+				"Parsing a string mixing escape sequences and unescaped characters as JSON should parse successfully.");
+
+		String json_value = json.get_data();
+		CHECK_MESSAGE(
+				json_value == String::utf8("Hello\tworld\xc3\xa9 \"quoted\" text\\"),
+				"Parsing a string mixing escape sequences and unescaped characters as JSON should return the expected value.");
+	}
+
 	SUBCASE("Invalid escape sequences") {
 		ERR_PRINT_OFF
 		for (char32_t i = 0; i < 128; i++) {
@@ -489,4 +489,37 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Packed array Variant encoding and decoding") {
+	PackedInt32Array int32_array = { 0x12345678, -1, 0 };
+	PackedFloat64Array float64_array = { 1.0 / 3.0, -2.5, 0.0 };
+
+	int r_len;
+	uint8_t buffer[32];
+
+	CHECK(encode_variant(int32_array, buffer, r_len) == OK);
+	CHECK_MESSAGE(r_len == 20, "Length == 4 bytes for header + 4 bytes for size + 3 * 4 bytes for `int32_t`.");
+	CHECK_MESSAGE(buffer[0] == 0x1e, "Variant::PACKED_INT32_ARRAY");
+	CHECK_MESSAGE(buffer[4] == 0x03, "Array size.");
+	// Values are always stored in little-endian.
+	CHECK(buffer[8] == 0x78);
+	CHECK(buffer[9] == 0x56);
+	CHECK(buffer[10] == 0x34);
+	CHECK(buffer[11] == 0x12);
+	CHECK(buffer[12] == 0xff);
+	CHECK(buffer[15] == 0xff);
+
+	Variant variant;
+	int r_decoded_len;
+	CHECK(decode_variant(variant, buffer, r_len, &r_decoded_len) == OK);
+	CHECK(r_decoded_len == r_len);
+	CHECK(variant == Variant(int32_array));
+
+	CHECK(encode_variant(float64_array, buffer, r_len) == OK);
+	CHECK_MESSAGE(r_len == 32, "Length == 4 bytes for header + 4 bytes for size + 3 * 8 bytes for `double`.");
+
+	CHECK(decode_variant(variant, buffer, r_len, &r_decoded_len) == OK);
+	CHECK(r_decoded_len == r_len);
+	CHECK(variant == Variant(float64_array));
+}
+
 } // namespace TestMarshalls
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  test_call_queue.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/message_queue.h"
+#include "core/object/object.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCallQueue {
+
+class CallRecorder : public Object {
+public:
+	LocalVector<int> calls;
+
+	void record(int p_value) {
+		calls.push_back(p_value);
+	}
+
+	// Always takes longer than the tiny budgets used by the tests.
+	void record_slow(int p_value) {
+		OS::get_singleton()->delay_usec(2);
+		calls.push_back(p_value);
+	}
+};
+
+TEST_CASE("[CallQueue] Low priority calls run after regular calls") {
+	CallQueue queue;
+	CallRecorder recorder;
+
+	queue.push_low_priority_callable(callable_mp(&recorder, &CallRecorder::record), 3);
+	queue.push_callable(callable_mp(&recorder, &CallRecorder::record), 1);
+	queue.push_callable(callable_mp(&recorder, &CallRecorder::record), 2);
+	CHECK(queue.has_messages());
+
+	queue.flush();
+	CHECK_FALSE(queue.has_messages());
+	REQUIRE_EQ(recorder.calls.size(), 3u);
+	CHECK_EQ(recorder.calls[0], 1);
+	CHECK_EQ(recorder.calls[1], 2);
+	CHECK_EQ(recorder.calls[2], 3);
+}
+
+TEST_CASE("[CallQueue] Low priority calls are spread across flushes by the budget") {
+	CallQueue queue;
+	CallRecorder recorder;
+	// At least one call runs per flush, and each call uses up the whole budget.
+	queue.set_low_priority_budget_usec(1);
+
+	// Enough calls to need several pages.
+	const int count = 1000;
+	for (int i = 0; i < count; i++) {
+		queue.push_low_priority_callable(callable_mp(&recorder, &CallRecorder::record_slow), i);
+	}
+
+	queue.flush();
+	CHECK_MESSAGE(recorder.calls.size() == 1, "A flush should stop running low priority calls once the budget is used.");
+	CHECK(queue.has_messages());
+
+	int flushes = 1;
+	while (queue.has_messages() && flushes < count) {
+		queue.flush();
+		flushes++;
+		CHECK_GE(recorder.calls.size(), uint32_t(flushes));
+	}
+
+	CHECK_MESSAGE(flushes == count, "Each flush should have run exactly one low priority call.");
+	CHECK_FALSE(queue.has_messages());
+	REQUIRE_EQ(recorder.calls.size(), uint32_t(count));
+	bool in_order = true;
+	for (int i = 0; i < count; i++) {
+		in_order = in_order && recorder.calls[i] == i;
+	}
+	CHECK_MESSAGE(in_order, "Low priority calls should run in the order they were pushed.");
+}
+
+TEST_CASE("[CallQueue] Low priority deferred assignments") {
+	Object object;
+	object.set_deferred_low_priority("metadata/value", 2);
+	object.set_deferred("metadata/value", 1);
+	CHECK_FALSE(object.has_meta("value"));
+
+	MessageQueue::get_singleton()->flush();
+	CHECK_EQ(int(object.get_meta("value")), 2);
+}
+
+} // namespace TestCallQueue
@@ -33,6 +33,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
 
@@ -214,6 +215,45 @@ TEST_CASE("[Object] Construction") {
 			"The database pointer returned by the object id should reference same object.");
 }
 
+static void _objectdb_churn_task(void *p_userdata, uint32_t p_index) {
+	SafeNumeric<uint32_t> *failures = (SafeNumeric<uint32_t> *)p_userdata;
+	Object *objects[64];
+	ObjectID ids[64];
+	for (int round = 0; round < 16; round++) {
+		for (int i = 0; i < 64; i++) {
+			objects[i] = memnew(Object);
+			ids[i] = objects[i]->get_instance_id();
+		}
+		for (int i = 0; i < 64; i++) {
+			if (ObjectDB::get_instance(ids[i]) != objects[i]) {
+				failures->increment();
+			}
+			memdelete(objects[i]);
+		}
+		for (int i = 0; i < 64; i++) {
+			if (ObjectDB::get_instance(ids[i]) != nullptr) {
+				failures->increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] Concurrent construction and destruction") {
+	// Stresses ObjectDB slot allocation and lookups from every pool thread at once.
+	const int object_count = ObjectDB::get_object_count();
+	SafeNumeric<uint32_t> failures;
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(_objectdb_churn_task, &failures, 256, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK_MESSAGE(
+			failures.get() == 0,
+			"Object IDs should resolve to their object while alive, and to null once freed.");
+	CHECK_MESSAGE(
+			ObjectDB::get_object_count() == object_count,
+			"All objects created by the worker threads should have been released.");
+}
+
 TEST_CASE("[Object] Script instance property setter") {
 	Object object;
 	_MockScriptInstance *script_instance = memnew(_MockScriptInstance);
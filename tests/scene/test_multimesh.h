@@ -0,0 +1,95 @@
+/**************************************************************************/
+/*  test_multimesh.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/resources/multimesh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMultiMesh {
+
+static Ref<MultiMesh> make_multimesh(int p_instance_count) {
+	Ref<MultiMesh> multimesh;
+	multimesh.instantiate();
+	multimesh->set_transform_format(MultiMesh::TRANSFORM_3D);
+	multimesh->set_use_colors(true);
+	multimesh->set_instance_count(p_instance_count);
+	return multimesh;
+}
+
+static Vector<float> make_buffer(int p_instance_count, int p_stride, float p_value) {
+	Vector<float> buffer;
+	buffer.resize(p_instance_count * p_stride);
+	buffer.fill(p_value);
+	return buffer;
+}
+
+TEST_CASE("[SceneTree][MultiMesh] Set buffer range") {
+	const int stride = 16; // Transform3D + Color.
+	Ref<MultiMesh> multimesh = make_multimesh(10);
+	RS::get_singleton()->multimesh_set_buffer(multimesh->get_rid(), make_buffer(10, stride, 0.0));
+
+	SUBCASE("Only the given range is updated") {
+		multimesh->set_buffer_range(3, make_buffer(4, stride, 1.0));
+
+		Vector<float> buffer = RS::get_singleton()->multimesh_get_buffer(multimesh->get_rid());
+		REQUIRE(buffer.size() == 10 * stride);
+		for (int i = 0; i < 10; i++) {
+			const float expected = (i >= 3 && i < 7) ? 1.0 : 0.0;
+			CHECK_MESSAGE(buffer[i * stride] == expected, vformat("Unexpected data for instance %d.", i));
+			CHECK_MESSAGE(buffer[i * stride + stride - 1] == expected, vformat("Unexpected data for instance %d.", i));
+		}
+	}
+
+	SUBCASE("The range can end on the last instance") {
+		multimesh->set_buffer_range(8, make_buffer(2, stride, 2.0));
+
+		Vector<float> buffer = RS::get_singleton()->multimesh_get_buffer(multimesh->get_rid());
+		CHECK(buffer[7 * stride] == 0.0);
+		CHECK(buffer[8 * stride] == 2.0);
+		CHECK(buffer[10 * stride - 1] == 2.0);
+	}
+
+	SUBCASE("Invalid ranges are rejected") {
+		ERR_PRINT_OFF;
+		multimesh->set_buffer_range(0, make_buffer(1, stride - 1, 3.0));
+		multimesh->set_buffer_range(-1, make_buffer(1, stride, 3.0));
+		multimesh->set_buffer_range(9, make_buffer(2, stride, 3.0));
+		ERR_PRINT_ON;
+
+		Vector<float> buffer = RS::get_singleton()->multimesh_get_buffer(multimesh->get_rid());
+		for (int i = 0; i < buffer.size(); i++) {
+			REQUIRE(buffer[i] == 0.0);
+		}
+	}
+}
+
+} // namespace TestMultiMesh
@@ -393,6 +393,31 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(child_by_path, node1_1);
 	}
 
+	SUBCASE("Repeated node path lookups should follow tree changes") {
+		Node *root = SceneTree::get_singleton()->get_root();
+		node1->set_name("Node1");
+		node1_1->set_name("NestedNode");
+
+		const NodePath path("Node1/NestedNode");
+		CHECK_EQ(root->get_node_or_null(path), node1_1);
+		CHECK_EQ(root->get_node_or_null(path), node1_1);
+
+		node1_1->set_name("Renamed");
+		CHECK_EQ(root->get_node_or_null(path), nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/Renamed")), node1_1);
+
+		node1_1->reparent(node2);
+		node2->set_name("Node2");
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/Renamed")), nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node2/Renamed")), node1_1);
+
+		node1_1->set_owner(node2);
+		node1_1->set_unique_name_in_owner(true);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node2/%Renamed")), node1_1);
+		node1_1->set_unique_name_in_owner(false);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node2/%Renamed")), nullptr);
+	}
+
 	SUBCASE("Nodes should be accessible via their groups") {
 		List<Node *> nodes;
 		SceneTree::get_singleton()->get_nodes_in_group("nodes", &nodes);
@@ -436,6 +461,44 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(E->get(), node1_1);
 	}
 
+	SUBCASE("Nodes in a group should stay in tree order after removals") {
+		node2->add_to_group("nodes");
+		node1_1->add_to_group("nodes");
+		node1->add_to_group("nodes");
+
+		List<Node *> nodes;
+		SceneTree::get_singleton()->get_nodes_in_group("nodes", &nodes);
+		CHECK_EQ(nodes.size(), 3);
+		CHECK_EQ(nodes.get(0), node1);
+		CHECK_EQ(nodes.get(1), node1_1);
+		CHECK_EQ(nodes.get(2), node2);
+
+		// Removing the first node moves the last one in its place internally.
+		node1->remove_from_group("nodes");
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("nodes"), 2);
+		CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("nodes"), node1_1);
+
+		nodes.clear();
+		SceneTree::get_singleton()->get_nodes_in_group("nodes", &nodes);
+		CHECK_EQ(nodes.size(), 2);
+		CHECK_EQ(nodes.get(0), node1_1);
+		CHECK_EQ(nodes.get(1), node2);
+
+		// Removing and adding nodes again should still work after the group was reordered.
+		node1_1->remove_from_group("nodes");
+		node1->add_to_group("nodes");
+		node2->remove_from_group("nodes");
+		CHECK_FALSE(node2->is_in_group("nodes"));
+
+		nodes.clear();
+		SceneTree::get_singleton()->get_nodes_in_group("nodes", &nodes);
+		CHECK_EQ(nodes.size(), 1);
+		CHECK_EQ(nodes.get(0), node1);
+
+		node1->remove_from_group("nodes");
+		CHECK_FALSE(SceneTree::get_singleton()->has_group("nodes"));
+	}
+
 	SUBCASE("Nodes added as siblings of another node should be right next to it") {
 		node1->remove_child(node1_1);
 
@@ -523,6 +586,175 @@ TEST_CASE("[SceneTree][Node] Duplicating node with internal children") {
 	memdelete(dup);
 }
 
+TEST_CASE("[SceneTree][Node] Adding children in a batch") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	Node *existing = memnew(Node);
+	parent->add_child(existing);
+
+	Node *orphan_parent = memnew(Node);
+	Node *already_parented = memnew(Node);
+	orphan_parent->add_child(already_parented);
+
+	TypedArray<Node> batch;
+	for (int i = 0; i < 3; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Child");
+		batch.push_back(child);
+	}
+	batch.insert(1, already_parented);
+
+	ERR_PRINT_OFF;
+	parent->add_children(batch);
+	ERR_PRINT_ON;
+
+	CHECK_EQ(parent->get_child_count(), 4);
+	CHECK_EQ(parent->get_child(0), existing);
+	CHECK_EQ(parent->get_child(1), Object::cast_to<Node>(batch[0]));
+	CHECK_EQ(parent->get_child(2), Object::cast_to<Node>(batch[2]));
+	CHECK_EQ(parent->get_child(3), Object::cast_to<Node>(batch[3]));
+	CHECK_EQ(already_parented->get_parent(), orphan_parent);
+	for (int i = 1; i < 4; i++) {
+		CHECK(parent->get_child(i)->is_inside_tree());
+	}
+
+	// Names are still made unique, as with sequential add_child() calls.
+	CHECK_EQ(parent->get_child(1)->get_name(), StringName("Child"));
+	CHECK_NE(parent->get_child(2)->get_name(), StringName("Child"));
+	CHECK_NE(parent->get_child(2)->get_name(), parent->get_child(3)->get_name());
+
+	memdelete(parent);
+	memdelete(orphan_parent);
+}
+
+class FreeOnEnterTreeNode : public Node {
+	GDCLASS(FreeOnEnterTreeNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_ENTER_TREE && node_to_free) {
+			memdelete(node_to_free);
+			node_to_free = nullptr;
+		}
+	}
+
+public:
+	Node *node_to_free = nullptr;
+};
+
+TEST_CASE("[SceneTree][Node] Adding children in a batch skips nodes freed by earlier children") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	FreeOnEnterTreeNode *first = memnew(FreeOnEnterTreeNode);
+	Node *freed = memnew(Node);
+	Node *last = memnew(Node);
+	first->node_to_free = freed;
+
+	TypedArray<Node> batch;
+	batch.push_back(first);
+	batch.push_back(freed);
+	batch.push_back(last);
+	parent->add_children(batch);
+
+	CHECK_EQ(parent->get_child_count(), 2);
+	CHECK_EQ(parent->get_child(0), first);
+	CHECK_EQ(parent->get_child(1), last);
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Propagated notifications are delivered in tree order") {
+	GDREGISTER_CLASS(TestNode);
+
+	List<Node *> callback_list;
+	TestNode *nodes[4];
+	for (int i = 0; i < 4; i++) {
+		nodes[i] = memnew(TestNode);
+		nodes[i]->callback_list = &callback_list;
+	}
+	// 0
+	// |- 1
+	// |  `- 3
+	// `- 2
+	nodes[0]->add_child(nodes[1]);
+	nodes[0]->add_child(nodes[2]);
+	nodes[1]->add_child(nodes[3]);
+
+	nodes[0]->propagate_notification(Node::NOTIFICATION_PROCESS);
+
+	REQUIRE_EQ(callback_list.size(), 4);
+	List<Node *>::Element *E = callback_list.front();
+	CHECK_EQ(E->get(), nodes[0]);
+	E = E->next();
+	CHECK_EQ(E->get(), nodes[1]);
+	E = E->next();
+	CHECK_EQ(E->get(), nodes[3]);
+	E = E->next();
+	CHECK_EQ(E->get(), nodes[2]);
+
+	// Nodes are no longer blocked once the notification is done.
+	Node *extra = memnew(Node);
+	nodes[1]->add_child(extra);
+	CHECK_EQ(extra->get_parent(), nodes[1]);
+
+	memdelete(nodes[0]);
+}
+
+class NestedPropagationNode : public Node {
+	GDCLASS(NestedPropagationNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS && target) {
+			target->propagate_notification(NOTIFICATION_PHYSICS_PROCESS);
+		}
+	}
+
+public:
+	Node *target = nullptr;
+};
+
+TEST_CASE("[SceneTree][Node] Propagating a notification from a propagated notification") {
+	GDREGISTER_CLASS(TestNode);
+	GDREGISTER_CLASS(NestedPropagationNode);
+
+	List<Node *> callback_list;
+	TestNode *root = memnew(TestNode);
+	NestedPropagationNode *nested = memnew(NestedPropagationNode);
+	TestNode *last = memnew(TestNode);
+	TestNode *target = memnew(TestNode);
+	TestNode *target_child = memnew(TestNode);
+	root->callback_list = &callback_list;
+	last->callback_list = &callback_list;
+	target->callback_list = &callback_list;
+	target_child->callback_list = &callback_list;
+
+	root->add_child(nested);
+	root->add_child(last);
+	target->add_child(target_child);
+	nested->target = target;
+
+	root->propagate_notification(Node::NOTIFICATION_PROCESS);
+
+	// The nested propagation must not disturb the outer one.
+	REQUIRE_EQ(callback_list.size(), 4);
+	List<Node *>::Element *E = callback_list.front();
+	CHECK_EQ(E->get(), root);
+	E = E->next();
+	CHECK_EQ(E->get(), target);
+	E = E->next();
+	CHECK_EQ(E->get(), target_child);
+	E = E->next();
+	CHECK_EQ(E->get(), last);
+	CHECK_EQ(last->process_counter, 1);
+	CHECK_EQ(target_child->physics_process_counter, 1);
+
+	memdelete(root);
+	memdelete(target);
+}
+
 TEST_CASE("[SceneTree][Node]Exported node checks") {
 	TestNode *node = memnew(TestNode);
 	SceneTree::get_singleton()->get_root()->add_child(node);
@@ -916,4 +1148,83 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree] Planning the tasks of threaded process groups") {
+	LocalVector<SceneTree::ThreadedProcessWork> work;
+	LocalVector<SceneTree::ThreadedProcessTask> tasks;
+
+	SUBCASE("Groups are ordered by cost, and parallel groups are split in ranges") {
+		work.push_back({ 10, 1, false });
+		work.push_back({ 400, 1000, true });
+		work.push_back({ 50, 1, false });
+
+		SceneTree::plan_threaded_process_tasks(work, 4, tasks);
+
+		REQUIRE(tasks.size() > 3);
+		for (uint32_t i = 1; i < tasks.size(); i++) {
+			CHECK(tasks[i - 1].cost_usec >= tasks[i].cost_usec);
+		}
+		CHECK(tasks[tasks.size() - 2].work_index == 2);
+		CHECK(tasks[tasks.size() - 1].work_index == 0);
+
+		// The ranges of the parallel group cover all its nodes, without overlapping.
+		uint32_t next = 0;
+		for (uint32_t i = 0; i < tasks.size() - 2; i++) {
+			CHECK(tasks[i].work_index == 1);
+			CHECK(tasks[i].from == next);
+			CHECK(tasks[i].to > tasks[i].from);
+			next = tasks[i].to;
+		}
+		CHECK(next == 1000);
+	}
+
+	SUBCASE("Unmeasured parallel groups are spread over all threads") {
+		work.push_back({ 0, 1000, true });
+
+		SceneTree::plan_threaded_process_tasks(work, 4, tasks);
+
+		CHECK(tasks.size() == 4);
+	}
+
+	SUBCASE("Small parallel groups are not split") {
+		work.push_back({ 400, SceneTree::MIN_NODES_PER_PROCESS_TASK, true });
+		work.push_back({ 10, 1, false });
+
+		SceneTree::plan_threaded_process_tasks(work, 4, tasks);
+
+		REQUIRE(tasks.size() == 2);
+		CHECK(tasks[0].work_index == 0);
+		CHECK(tasks[0].from == 0);
+		CHECK(tasks[0].to == SceneTree::MIN_NODES_PER_PROCESS_TASK);
+	}
+}
+
+TEST_CASE("[SceneTree][Node] Processing a parallel thread group") {
+	Node *owner = memnew(Node);
+	owner->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	owner->set_process_thread_group_parallel(true);
+	SceneTree::get_singleton()->get_root()->add_child(owner);
+
+	LocalVector<TestNode *> nodes;
+	for (uint32_t i = 0; i < SceneTree::MIN_NODES_PER_PROCESS_TASK * 8; i++) {
+		TestNode *node = memnew(TestNode);
+		node->set_process(true);
+		node->set_physics_process(true);
+		owner->add_child(node);
+		nodes.push_back(node);
+	}
+
+	// The second frame is split using the cost measured on the first one.
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	for (TestNode *node : nodes) {
+		CHECK_EQ(2, node->process_counter);
+		CHECK_EQ(2, node->physics_process_counter);
+	}
+
+	memdelete(owner);
+}
+
 } // namespace TestNode
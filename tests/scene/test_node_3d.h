@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class VisibilityTestNode3D : public Node3D {
+	GDCLASS(VisibilityTestNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what != NOTIFICATION_VISIBILITY_CHANGED) {
+			return;
+		}
+		visibility_changes++;
+
+		if (sibling_to_free) {
+			memdelete(sibling_to_free);
+			sibling_to_free = nullptr;
+		}
+		for (int i = 0; i < siblings_to_add; i++) {
+			get_parent()->add_child(memnew(Node3D));
+		}
+		siblings_to_add = 0;
+	}
+
+public:
+	int visibility_changes = 0;
+	Node3D *sibling_to_free = nullptr;
+	int siblings_to_add = 0;
+};
+
+TEST_CASE("[SceneTree][Node3D] Visibility changes while siblings are added and freed") {
+	Node3D *parent = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	VisibilityTestNode3D *first = memnew(VisibilityTestNode3D);
+	Node3D *second = memnew(Node3D);
+	VisibilityTestNode3D *third = memnew(VisibilityTestNode3D);
+	parent->add_child(first);
+	parent->add_child(second);
+	parent->add_child(third);
+
+	parent->hide();
+	first->visibility_changes = 0;
+	third->visibility_changes = 0;
+
+	// Enough new siblings to reallocate the parent's child list.
+	first->sibling_to_free = second;
+	first->siblings_to_add = 32;
+	parent->show();
+
+	CHECK_EQ(first->visibility_changes, 1);
+	CHECK_MESSAGE(third->visibility_changes == 1, "Siblings after the changed ones should be notified exactly once.");
+	CHECK_EQ(parent->get_child_count(), 34);
+
+	memdelete(parent);
+}
+
+} // namespace TestNode3D
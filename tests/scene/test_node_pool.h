@@ -0,0 +1,239 @@
+/**************************************************************************/
+/*  test_node_pool.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/main/node_pool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNodePool {
+
+class PoolTestNode : public Node {
+	GDCLASS(PoolTestNode, Node);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("set_target", "target"), &PoolTestNode::set_target);
+		ClassDB::bind_method(D_METHOD("get_target"), &PoolTestNode::get_target);
+		ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "target", PROPERTY_HINT_NODE_TYPE, "Node"), "set_target", "get_target");
+
+		ClassDB::bind_method(D_METHOD("set_resource", "resource"), &PoolTestNode::set_resource);
+		ClassDB::bind_method(D_METHOD("get_resource"), &PoolTestNode::get_resource);
+		ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "resource", PROPERTY_HINT_RESOURCE_TYPE, "Resource"), "set_resource", "get_resource");
+	}
+
+public:
+	Node *target = nullptr;
+	Ref<Resource> resource;
+
+	void set_target(Node *p_target) { target = p_target; }
+	Node *get_target() const { return target; }
+
+	void set_resource(const Ref<Resource> &p_resource) { resource = p_resource; }
+	Ref<Resource> get_resource() const { return resource; }
+};
+
+TEST_CASE("[SceneTree][NodePool] Acquire and release") {
+	Node *scene_root = memnew(Node);
+	scene_root->set_name("Projectile");
+	Node *child = memnew(Node);
+	child->set_name("Trail");
+	scene_root->add_child(child);
+	child->set_owner(scene_root);
+	scene_root->add_to_group("projectiles", true);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	REQUIRE(packed_scene->pack(scene_root) == OK);
+	memdelete(scene_root);
+
+	Ref<NodePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+
+	SUBCASE("Released nodes should be reused") {
+		Node *node = pool->acquire();
+		REQUIRE(node != nullptr);
+		CHECK(node->has_node(NodePath("Trail")));
+
+		SceneTree::get_singleton()->get_root()->add_child(node);
+		pool->release(node);
+		CHECK(node->get_parent() == nullptr);
+		CHECK_EQ(pool->get_available_count(), 1);
+
+		CHECK_EQ(pool->acquire(), node);
+		CHECK_EQ(pool->get_available_count(), 0);
+		pool->release(node);
+	}
+
+	SUBCASE("Released nodes should be reset") {
+		Node *node = pool->acquire();
+		Node *trail = node->get_node(NodePath("Trail"));
+		trail->set_process_mode(Node::PROCESS_MODE_DISABLED);
+		node->add_to_group("hit");
+
+		Node *target = memnew(Node);
+		node->connect(SceneStringName(ready), callable_mp(target, &Node::queue_free));
+
+		pool->release(node);
+		CHECK_EQ(trail->get_process_mode(), Node::PROCESS_MODE_INHERIT);
+		CHECK_FALSE(node->is_in_group("hit"));
+		CHECK(node->is_in_group("projectiles"));
+		CHECK_FALSE(node->is_connected(SceneStringName(ready), callable_mp(target, &Node::queue_free)));
+
+		memdelete(target);
+	}
+
+	SUBCASE("Connections made before acquiring should be kept") {
+		Node *node = pool->acquire();
+		Node *trail = node->get_node(NodePath("Trail"));
+		pool->release(node);
+
+		// Stands in for a connection a node makes to one of its own resources.
+		Node *target = memnew(Node);
+		trail->connect(SceneStringName(ready), callable_mp(target, &Node::queue_free));
+
+		CHECK_EQ(pool->acquire(), node);
+		Node *user_target = memnew(Node);
+		trail->connect("renamed", callable_mp(user_target, &Node::queue_free));
+		pool->release(node);
+
+		CHECK(trail->is_connected(SceneStringName(ready), callable_mp(target, &Node::queue_free)));
+		CHECK_FALSE(trail->is_connected("renamed", callable_mp(user_target, &Node::queue_free)));
+
+		trail->disconnect(SceneStringName(ready), callable_mp(target, &Node::queue_free));
+		memdelete(target);
+		memdelete(user_target);
+	}
+
+	SUBCASE("Reused nodes should be ready again") {
+		Node *node = pool->acquire();
+		SceneTree::get_singleton()->get_root()->add_child(node);
+		pool->release(node);
+
+		CHECK_EQ(pool->acquire(), node);
+		SIGNAL_WATCH(node, SceneStringName(ready));
+		SceneTree::get_singleton()->get_root()->add_child(node);
+		Array empty_signal_args = { {} };
+		SIGNAL_CHECK(SceneStringName(ready), empty_signal_args);
+		SIGNAL_UNWATCH(node, SceneStringName(ready));
+		pool->release(node);
+	}
+
+	SUBCASE("Pool size should be bounded") {
+		pool->set_max_size(2);
+		pool->prewarm(5);
+		CHECK_EQ(pool->get_available_count(), 2);
+
+		Node *a = pool->acquire();
+		Node *b = pool->acquire();
+		Node *c = pool->acquire();
+		pool->release(a);
+		pool->release(b);
+		pool->release(c); // Freed, the pool is full.
+		CHECK_EQ(pool->get_available_count(), 2);
+	}
+
+	SUBCASE("Nodes queued for deletion should be rejected") {
+		Node *node = pool->acquire();
+		node->queue_free();
+		ERR_PRINT_OFF;
+		pool->release(node);
+		ERR_PRINT_ON;
+		CHECK_EQ(pool->get_available_count(), 0);
+	}
+
+	SUBCASE("Pooled nodes freed by something else should be skipped") {
+		Node *node = pool->acquire();
+		pool->release(node);
+		memdelete(node);
+		CHECK_EQ(pool->get_available_count(), 0);
+
+		Node *other = pool->acquire();
+		REQUIRE(other != nullptr);
+		CHECK(other->has_node(NodePath("Trail")));
+		pool->release(other);
+	}
+
+	SUBCASE("Nodes not acquired from the pool should be rejected") {
+		Node *node = memnew(Node);
+		ERR_PRINT_OFF;
+		pool->release(node);
+		ERR_PRINT_ON;
+		CHECK_EQ(pool->get_available_count(), 0);
+		memdelete(node);
+	}
+}
+
+TEST_CASE("[SceneTree][NodePool] References into the scene are restored for each instance") {
+	GDREGISTER_CLASS(PoolTestNode);
+
+	PoolTestNode *scene_root = memnew(PoolTestNode);
+	scene_root->set_name("Turret");
+	Node *barrel = memnew(Node);
+	barrel->set_name("Barrel");
+	scene_root->add_child(barrel);
+	barrel->set_owner(scene_root);
+	scene_root->set_target(barrel);
+	Ref<Resource> resource;
+	resource.instantiate();
+	resource->set_local_to_scene(true);
+	scene_root->set_resource(resource);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	REQUIRE(packed_scene->pack(scene_root) == OK);
+	memdelete(scene_root);
+
+	Ref<NodePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+
+	// The first instance is the one the reset state is captured from.
+	PoolTestNode *first = Object::cast_to<PoolTestNode>(pool->acquire());
+	PoolTestNode *second = Object::cast_to<PoolTestNode>(pool->acquire());
+	REQUIRE(first != nullptr);
+	REQUIRE(second != nullptr);
+	const Ref<Resource> first_resource = first->get_resource();
+
+	pool->release(second);
+	CHECK_MESSAGE(second->get_target() == second->get_node(NodePath("Barrel")), "Node references should point into the same instance.");
+	REQUIRE(second->get_resource().is_valid());
+	CHECK_MESSAGE(second->get_resource() != first_resource, "Resources local to the scene shouldn't be shared between instances.");
+	CHECK(second->get_resource()->get_local_scene() == second);
+	CHECK(first->get_resource() == first_resource);
+
+	pool->release(first);
+	CHECK(first->get_target() == first->get_node(NodePath("Barrel")));
+	CHECK(first->get_resource() != second->get_resource());
+}
+
+} // namespace TestNodePool
@@ -215,6 +215,41 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Many Times") {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+	memdelete(scene);
+
+	TypedArray<Node> instances = packed_scene.instantiate_many(3);
+	REQUIRE(instances.size() == 3);
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+		for (int j = 0; j < i; j++) {
+			CHECK_MESSAGE(instances[j] != instances[i], "Each instance should be a separate node.");
+		}
+	}
+	for (int i = 0; i < instances.size(); i++) {
+		memdelete(Object::cast_to<Node>(instances[i]));
+	}
+
+	CHECK(packed_scene.instantiate_many(0).is_empty());
+
+	ERR_PRINT_OFF;
+	CHECK(packed_scene.instantiate_many(-1).is_empty());
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
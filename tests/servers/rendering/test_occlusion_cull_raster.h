@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*  test_occlusion_cull_raster.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/projection.h"
+#include "servers/rendering/renderer_scene_occlusion_cull_raster.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOcclusionCullRaster {
+
+// A 100x100 quad facing the camera, centered on the origin.
+static const Vector3 wall_vertices[4] = {
+	Vector3(-50, -50, 0),
+	Vector3(50, -50, 0),
+	Vector3(50, 50, 0),
+	Vector3(-50, 50, 0),
+};
+static const int32_t wall_indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+static RendererSceneOcclusionCullRaster::RasterHZBuffer::Mesh make_wall(const Vector3 &p_position) {
+	RendererSceneOcclusionCullRaster::RasterHZBuffer::Mesh mesh;
+	mesh.vertices = wall_vertices;
+	mesh.vertex_count = 4;
+	mesh.indices = wall_indices;
+	mesh.index_count = 6;
+	mesh.xform.origin = p_position;
+	return mesh;
+}
+
+static bool is_box_occluded(const RendererSceneOcclusionCullRaster::RasterHZBuffer &p_buffer, const AABB &p_box, const Projection &p_projection) {
+	const real_t bounds[6] = { p_box.position.x, p_box.position.y, p_box.position.z, p_box.get_end().x, p_box.get_end().y, p_box.get_end().z };
+	uint64_t timeout = 0;
+	return p_buffer.is_occluded(bounds, Vector3(), Transform3D(), p_projection, p_projection.get_z_near(), timeout);
+}
+
+TEST_CASE("[OcclusionCullRaster] Wall occludes boxes behind it with a perspective camera") {
+	RendererSceneOcclusionCullRaster::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 36));
+
+	Projection projection;
+	projection.set_perspective(75, 16.0 / 9.0, 0.05, 200);
+
+	LocalVector<RendererSceneOcclusionCullRaster::RasterHZBuffer::Mesh> meshes;
+	meshes.push_back(make_wall(Vector3(0, 0, -5)));
+	buffer.rasterize(meshes, Transform3D(), projection, false);
+
+	CHECK_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2)), projection), "A box behind the wall should be occluded.");
+	CHECK_MESSAGE(is_box_occluded(buffer, AABB(Vector3(3, -2, -12), Vector3(1, 1, 1)), projection), "An off-center box behind the wall should be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(-1, -1, -4), Vector3(2, 2, 2)), projection), "A box in front of the wall should not be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2)), projection), "A box intersecting the wall should not be occluded.");
+}
+
+TEST_CASE("[OcclusionCullRaster] Moved occluders are used without any rebuild") {
+	RendererSceneOcclusionCullRaster::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 36));
+
+	Projection projection;
+	projection.set_perspective(75, 16.0 / 9.0, 0.05, 200);
+	const AABB box(Vector3(-1, -1, -21), Vector3(2, 2, 2));
+
+	LocalVector<RendererSceneOcclusionCullRaster::RasterHZBuffer::Mesh> meshes;
+	meshes.push_back(make_wall(Vector3(0, 0, -5)));
+	buffer.rasterize(meshes, Transform3D(), projection, false);
+	CHECK(is_box_occluded(buffer, box, projection));
+
+	meshes[0].xform.origin = Vector3(200, 0, -5);
+	buffer.rasterize(meshes, Transform3D(), projection, false);
+	CHECK_MESSAGE(!is_box_occluded(buffer, box, projection), "The box should be visible once the wall moved away.");
+
+	meshes.clear();
+	buffer.rasterize(meshes, Transform3D(), projection, false);
+	CHECK_MESSAGE(!is_box_occluded(buffer, box, projection), "Nothing should be occluded without occluders.");
+}
+
+TEST_CASE("[OcclusionCullRaster] Triangles crossing the near plane are clipped") {
+	RendererSceneOcclusionCullRaster::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 36));
+
+	Projection projection;
+	projection.set_perspective(75, 16.0 / 9.0, 0.05, 200);
+
+	// A floor extending from behind the camera into the distance.
+	const Vector3 floor_vertices[4] = {
+		Vector3(-100, -1, 50),
+		Vector3(100, -1, 50),
+		Vector3(100, -1, -100),
+		Vector3(-100, -1, -100),
+	};
+	RendererSceneOcclusionCullRaster::RasterHZBuffer::Mesh mesh;
+	mesh.vertices = floor_vertices;
+	mesh.vertex_count = 4;
+	mesh.indices = wall_indices;
+	mesh.index_count = 6;
+
+	LocalVector<RendererSceneOcclusionCullRaster::RasterHZBuffer::Mesh> meshes;
+	meshes.push_back(mesh);
+	buffer.rasterize(meshes, Transform3D(), projection, false);
+
+	CHECK_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-1, -5, -20), Vector3(2, 2, 2)), projection), "A box under the floor should be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(-1, 0, -20), Vector3(2, 2, 2)), projection), "A box above the floor should not be occluded.");
+}
+
+TEST_CASE("[OcclusionCullRaster] Wall occludes boxes behind it with an orthogonal camera") {
+	RendererSceneOcclusionCullRaster::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 36));
+
+	Projection projection;
+	projection.set_orthogonal(20, 16.0 / 9.0, 0.05, 200);
+
+	LocalVector<RendererSceneOcclusionCullRaster::RasterHZBuffer::Mesh> meshes;
+	meshes.push_back(make_wall(Vector3(0, 0, -5)));
+	buffer.rasterize(meshes, Transform3D(), projection, true);
+
+	CHECK(is_box_occluded(buffer, AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2)), projection));
+	CHECK(!is_box_occluded(buffer, AABB(Vector3(-1, -1, -4), Vector3(2, 2, 2)), projection));
+}
+
+} // namespace TestOcclusionCullRaster
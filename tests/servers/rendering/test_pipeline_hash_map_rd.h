@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*  test_pipeline_hash_map_rd.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/renderer_rd/pipeline_hash_map_rd.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPipelineHashMapRD {
+
+struct PipelineKey {
+	uint32_t id = 0;
+
+	uint32_t hash() const {
+		return hash_murmur3_one_32(id);
+	}
+};
+
+// Stands in for the shader data of the renderers. It records compilations without creating any pipelines on the device.
+class PipelineCreator {
+public:
+	PipelineHashMapRD<PipelineKey, PipelineCreator, void (PipelineCreator::*)(PipelineKey)> pipeline_hash_map;
+	SafeNumeric<uint32_t> creations;
+	Mutex compilations_mutex;
+	uint32_t compilations[RS::PIPELINE_SOURCE_MAX] = {};
+
+	void _create_pipeline(PipelineKey p_key) {
+		creations.increment();
+		pipeline_hash_map.add_compiled_pipeline(p_key.hash(), RID());
+	}
+
+	void wait_for_keys(const LocalVector<PipelineKey> &p_keys) {
+		for (const PipelineKey &key : p_keys) {
+			pipeline_hash_map.wait_for_pipeline(key.hash());
+		}
+	}
+
+	PipelineCreator() {
+		pipeline_hash_map.set_creation_object_and_function(this, &PipelineCreator::_create_pipeline);
+		pipeline_hash_map.set_compilations(compilations, &compilations_mutex);
+	}
+
+	~PipelineCreator() {
+		pipeline_hash_map.clear_pipelines();
+	}
+};
+
+static LocalVector<PipelineKey> make_keys(uint32_t p_count) {
+	LocalVector<PipelineKey> keys;
+	for (uint32_t i = 0; i < p_count; i++) {
+		keys.push_back({ i * 7 + 1 });
+	}
+	return keys;
+}
+
+TEST_CASE("[PipelineHashMapRD] Used pipelines are recorded once") {
+	PipelineCreator creator;
+	const LocalVector<PipelineKey> keys = make_keys(4);
+	for (const PipelineKey &key : keys) {
+		creator.pipeline_hash_map.get_pipeline(key, key.hash(), true, RS::PIPELINE_SOURCE_DRAW);
+	}
+	for (const PipelineKey &key : keys) {
+		creator.pipeline_hash_map.get_pipeline(key, key.hash(), true, RS::PIPELINE_SOURCE_DRAW);
+	}
+
+	CHECK(creator.creations.get() == 4);
+	CHECK(creator.compilations[RS::PIPELINE_SOURCE_DRAW] == 4);
+
+	const LocalVector<PipelineKey> used_keys = creator.pipeline_hash_map.get_used_keys();
+	REQUIRE(used_keys.size() == keys.size());
+	for (uint32_t i = 0; i < keys.size(); i++) {
+		CHECK_MESSAGE(used_keys[i].id == keys[i].id, "Used keys should be listed in submission order.");
+	}
+}
+
+TEST_CASE("[PipelineHashMapRD] Precompiling a list of keys") {
+	PipelineCreator creator;
+	LocalVector<PipelineKey> keys = make_keys(16);
+	keys.push_back(keys[0]);
+	creator.pipeline_hash_map.precompile_pipelines(keys, RS::PIPELINE_SOURCE_SPECIALIZATION);
+	creator.wait_for_keys(keys);
+
+	CHECK_MESSAGE(creator.creations.get() == 16, "Duplicate keys should only be compiled once.");
+	CHECK(creator.compilations[RS::PIPELINE_SOURCE_SPECIALIZATION] == 16);
+
+	// Draws after the warmup shouldn't compile anything.
+	for (const PipelineKey &key : keys) {
+		creator.pipeline_hash_map.get_pipeline(key, key.hash(), true, RS::PIPELINE_SOURCE_DRAW);
+	}
+	CHECK(creator.creations.get() == 16);
+	CHECK(creator.compilations[RS::PIPELINE_SOURCE_DRAW] == 0);
+}
+
+TEST_CASE("[PipelineHashMapRD] Replaying used keys after clearing pipelines") {
+	PipelineCreator creator;
+	const LocalVector<PipelineKey> keys = make_keys(8);
+	for (const PipelineKey &key : keys) {
+		creator.pipeline_hash_map.get_pipeline(key, key.hash(), true, RS::PIPELINE_SOURCE_DRAW);
+	}
+
+	// Same flow as a default specialization change: take the used keys, clear, and compile their replacements.
+	LocalVector<PipelineKey> used_keys = creator.pipeline_hash_map.get_used_keys();
+	creator.pipeline_hash_map.clear_pipelines();
+	CHECK(creator.pipeline_hash_map.get_used_keys().is_empty());
+	CHECK(creator.creations.get() == 8);
+
+	for (PipelineKey &key : used_keys) {
+		key.id += 1000;
+	}
+	creator.pipeline_hash_map.precompile_pipelines(used_keys, RS::PIPELINE_SOURCE_SPECIALIZATION);
+	creator.wait_for_keys(used_keys);
+	CHECK(creator.creations.get() == 16);
+	CHECK(creator.compilations[RS::PIPELINE_SOURCE_SPECIALIZATION] == 8);
+	CHECK_MESSAGE(creator.pipeline_hash_map.get_used_keys().size() == 8, "Replayed pipelines should be recorded as used.");
+
+	// Draws with the replacement keys shouldn't compile anything.
+	for (const PipelineKey &key : used_keys) {
+		creator.pipeline_hash_map.get_pipeline(key, key.hash(), true, RS::PIPELINE_SOURCE_DRAW);
+	}
+	CHECK(creator.creations.get() == 16);
+}
+
+} // namespace TestPipelineHashMapRD
@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*  test_render_list_radix_sort.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/random_pcg.h"
+#include "servers/rendering/render_list_radix_sort.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRenderListRadixSort {
+
+// Mimics the sort key layout of the scene renderers' surface caches.
+struct Surface {
+	union {
+		struct {
+			uint64_t sort_key1;
+			uint64_t sort_key2;
+		};
+	} sort;
+	uint32_t index = 0;
+};
+
+struct SortByKeyAndIndex {
+	_FORCE_INLINE_ bool operator()(const Surface *A, const Surface *B) const {
+		if (A->sort.sort_key2 != B->sort.sort_key2) {
+			return A->sort.sort_key2 < B->sort.sort_key2;
+		}
+		if (A->sort.sort_key1 != B->sort.sort_key1) {
+			return A->sort.sort_key1 < B->sort.sort_key1;
+		}
+		return A->index < B->index;
+	}
+};
+
+// Keys only vary in a few bytes, the same way material and geometry IDs leave most of the key constant.
+static void fill_surfaces(LocalVector<Surface> &r_surfaces, LocalVector<Surface *> &r_list, uint32_t p_count, uint32_t p_seed) {
+	RandomPCG rng(p_seed);
+	r_surfaces.resize(p_count);
+	r_list.resize(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_surfaces[i].sort.sort_key1 = (uint64_t(rng.rand(64)) << 40) | rng.rand(1024);
+		r_surfaces[i].sort.sort_key2 = (uint64_t(rng.rand(4)) << 62) | (uint64_t(rng.rand(16)) << 8);
+		r_surfaces[i].index = i;
+		r_list[i] = &r_surfaces[i];
+	}
+}
+
+static bool sorts_like_stable_sort(uint32_t p_count, uint32_t p_seed) {
+	LocalVector<Surface> surfaces;
+	LocalVector<Surface *> list;
+	fill_surfaces(surfaces, list, p_count, p_seed);
+
+	LocalVector<Surface *> expected = list;
+	SortArray<Surface *, SortByKeyAndIndex> sorter;
+	sorter.sort(expected.ptr(), expected.size());
+
+	RenderListRadixSort<Surface> radix_sort;
+	radix_sort.sort(list.ptr(), list.size());
+
+	// The comparison sort fallback isn't stable, so short lists only need to match keys.
+	const bool check_stability = p_count >= RenderListRadixSort<Surface>::MIN_ELEMENTS;
+	for (uint32_t i = 0; i < p_count; i++) {
+		if (list[i]->sort.sort_key1 != expected[i]->sort.sort_key1 || list[i]->sort.sort_key2 != expected[i]->sort.sort_key2) {
+			return false;
+		}
+		if (check_stability && list[i] != expected[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[RenderListRadixSort] Sorts like a stable comparison sort") {
+	CHECK_MESSAGE(sorts_like_stable_sort(RenderListRadixSort<Surface>::MIN_ELEMENTS - 1, 1), "Short lists should be sorted by the comparison sort fallback.");
+	CHECK_MESSAGE(sorts_like_stable_sort(RenderListRadixSort<Surface>::MIN_ELEMENTS, 2), "A list at the radix threshold should be sorted.");
+	CHECK_MESSAGE(sorts_like_stable_sort(5000, 3), "A single threaded radix sort should keep equal keys in submission order.");
+	CHECK_MESSAGE(sorts_like_stable_sort(RenderListRadixSort<Surface>::THREADED_MIN_ELEMENTS_PER_TASK * 8 + 17, 4), "A threaded radix sort should keep equal keys in submission order.");
+}
+
+TEST_CASE("[RenderListRadixSort] Identical keys and sub-ranges") {
+	LocalVector<Surface> surfaces;
+	LocalVector<Surface *> list;
+	fill_surfaces(surfaces, list, 1000, 5);
+	for (Surface &surface : surfaces) {
+		surface.sort.sort_key1 = 42;
+		surface.sort.sort_key2 = 7;
+	}
+
+	RenderListRadixSort<Surface> radix_sort;
+	radix_sort.sort(list.ptr(), list.size());
+	bool in_order = true;
+	for (uint32_t i = 0; i < list.size(); i++) {
+		in_order = in_order && list[i]->index == i;
+	}
+	CHECK_MESSAGE(in_order, "Identical keys should leave the list untouched.");
+
+	// Only sort the second half, like the renderers do for alpha passes.
+	for (uint32_t i = 0; i < surfaces.size(); i++) {
+		surfaces[i].sort.sort_key1 = surfaces.size() - i;
+	}
+	radix_sort.sort(list.ptr() + 500, 500);
+	bool range_sorted = true;
+	for (uint32_t i = 0; i < 500; i++) {
+		range_sorted = range_sorted && list[i]->index == i && list[500 + i]->index == surfaces.size() - 1 - i;
+	}
+	CHECK_MESSAGE(range_sorted, "Sorting a sub-range should only reorder that range.");
+}
+
+} // namespace TestRenderListRadixSort
@@ -0,0 +1,281 @@
+/**************************************************************************/
+/*  test_renderer_canvas_cull.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/random_pcg.h"
+#include "core/templates/sort_array.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+class TestRendererCanvasCullAccessor {
+public:
+	static RendererCanvasCull::Item *get_item(RID p_item) {
+		return RSG::canvas->canvas_item_owner.get_or_null(p_item);
+	}
+
+	// Culls the tree of p_item on its own, and returns the items that would be drawn, in order.
+	static LocalVector<RendererCanvasCull::Item *> cull(RID p_item, const Rect2 &p_clip_rect) {
+		RendererCanvasRender::Item *z_list[RendererCanvasCull::z_range] = {};
+		RendererCanvasRender::Item *z_last_list[RendererCanvasCull::z_range] = {};
+		RSG::canvas->_cull_canvas_item(get_item(p_item), Transform2D(), p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, false, 0xFFFFFFFF, Point2(), 1, nullptr);
+
+		LocalVector<RendererCanvasCull::Item *> drawn;
+		for (int i = 0; i < RendererCanvasCull::z_range; i++) {
+			for (RendererCanvasRender::Item *ci = z_list[i]; ci; ci = ci->next) {
+				drawn.push_back(static_cast<RendererCanvasCull::Item *>(ci));
+			}
+		}
+		return drawn;
+	}
+
+	static bool ysort_from_previous_order(LocalVector<RendererCanvasCull::Item *> &r_previous, RendererCanvasCull::Item **r_items, int p_count) {
+		return RSG::canvas->_ysort_from_previous_order(r_previous, r_items, p_count);
+	}
+};
+
+namespace TestRendererCanvasCull {
+
+static RID create_item(RID p_parent, const Vector2 &p_position) {
+	RID item = RSG::canvas->canvas_item_allocate();
+	RSG::canvas->canvas_item_initialize(item);
+	if (p_parent.is_valid()) {
+		RSG::canvas->canvas_item_set_parent(item, p_parent);
+	}
+	RSG::canvas->canvas_item_set_transform(item, Transform2D(0, p_position));
+	return item;
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Cached subtree bounds are invalidated by changes to the subtree") {
+	const Rect2 clip_rect(0, 0, 1000, 1000);
+
+	RID root = create_item(RID(), Vector2());
+	RID child = create_item(root, Vector2(20, 0));
+	RID grandchild = create_item(child, Vector2());
+	RSG::canvas->canvas_item_add_rect(grandchild, Rect2(0, 0, 10, 10), Color(1, 1, 1), false);
+
+	RendererCanvasCull::Item *root_item = TestRendererCanvasCullAccessor::get_item(root);
+	RendererCanvasCull::Item *child_item = TestRendererCanvasCullAccessor::get_item(child);
+
+	TestRendererCanvasCullAccessor::cull(root, clip_rect);
+	REQUIRE_FALSE(root_item->subtree_rect_dirty);
+	REQUIRE_FALSE(child_item->subtree_rect_dirty);
+	CHECK(root_item->subtree_rect_cacheable);
+	CHECK(root_item->subtree_rect.encloses(Rect2(20, 0, 10, 10)));
+
+	SUBCASE("Moving a child") {
+		RSG::canvas->canvas_item_set_transform(child, Transform2D(0, Vector2(200, 0)));
+		CHECK(root_item->subtree_rect_dirty);
+		CHECK(child_item->subtree_rect_dirty);
+
+		TestRendererCanvasCullAccessor::cull(root, clip_rect);
+		CHECK(root_item->subtree_rect.encloses(Rect2(200, 0, 10, 10)));
+	}
+
+	SUBCASE("Changing the draw commands") {
+		RSG::canvas->canvas_item_clear(grandchild);
+		CHECK(root_item->subtree_rect_dirty);
+		CHECK(child_item->subtree_rect_dirty);
+		TestRendererCanvasCullAccessor::cull(root, clip_rect);
+
+		RSG::canvas->canvas_item_add_rect(grandchild, Rect2(50, 50, 10, 10), Color(1, 1, 1), false);
+		CHECK(root_item->subtree_rect_dirty);
+		CHECK(child_item->subtree_rect_dirty);
+
+		TestRendererCanvasCullAccessor::cull(root, clip_rect);
+		CHECK(root_item->subtree_rect.encloses(Rect2(70, 50, 10, 10)));
+	}
+
+	SUBCASE("Reparenting") {
+		RID other = create_item(root, Vector2(300, 0));
+		TestRendererCanvasCullAccessor::cull(root, clip_rect);
+		REQUIRE_FALSE(root_item->subtree_rect_dirty);
+
+		RSG::canvas->canvas_item_set_parent(grandchild, other);
+		CHECK(root_item->subtree_rect_dirty);
+		CHECK(child_item->subtree_rect_dirty);
+		CHECK(TestRendererCanvasCullAccessor::get_item(other)->subtree_rect_dirty);
+
+		TestRendererCanvasCullAccessor::cull(root, clip_rect);
+		CHECK(child_item->subtree_rect.size == Size2());
+		CHECK(root_item->subtree_rect.encloses(Rect2(300, 0, 10, 10)));
+
+		RSG::canvas->free(other);
+	}
+
+	SUBCASE("Toggling visibility") {
+		RSG::canvas->canvas_item_set_visible(grandchild, false);
+		CHECK(root_item->subtree_rect_dirty);
+		CHECK(child_item->subtree_rect_dirty);
+
+		TestRendererCanvasCullAccessor::cull(root, clip_rect);
+		CHECK(child_item->subtree_rect.size == Size2());
+
+		RSG::canvas->canvas_item_set_visible(grandchild, true);
+		CHECK(root_item->subtree_rect_dirty);
+		CHECK(child_item->subtree_rect_dirty);
+
+		TestRendererCanvasCullAccessor::cull(root, clip_rect);
+		CHECK(root_item->subtree_rect.encloses(Rect2(20, 0, 10, 10)));
+	}
+
+	RSG::canvas->free(grandchild);
+	RSG::canvas->free(child);
+	RSG::canvas->free(root);
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Offscreen static subtrees are skipped") {
+	const Rect2 clip_rect(0, 0, 100, 100);
+
+	RID root = create_item(RID(), Vector2());
+	RID onscreen = create_item(root, Vector2(10, 10));
+	RID onscreen_child = create_item(onscreen, Vector2());
+	RSG::canvas->canvas_item_add_rect(onscreen_child, Rect2(0, 0, 10, 10), Color(1, 1, 1), false);
+	RID offscreen = create_item(root, Vector2(1000, 0));
+	RID offscreen_child = create_item(offscreen, Vector2());
+	RSG::canvas->canvas_item_add_rect(offscreen_child, Rect2(0, 0, 10, 10), Color(1, 1, 1), false);
+
+	RendererCanvasCull::Item *root_item = TestRendererCanvasCullAccessor::get_item(root);
+	RendererCanvasCull::Item *onscreen_child_item = TestRendererCanvasCullAccessor::get_item(onscreen_child);
+	RendererCanvasCull::Item *offscreen_child_item = TestRendererCanvasCullAccessor::get_item(offscreen_child);
+
+	// Visited items reset their material owner, so a marker left there tells whether the walk reached them.
+	onscreen_child_item->material_owner = root_item;
+	offscreen_child_item->material_owner = root_item;
+
+	LocalVector<RendererCanvasCull::Item *> drawn = TestRendererCanvasCullAccessor::cull(root, clip_rect);
+	CHECK(drawn.size() == 1);
+	CHECK(drawn.has(onscreen_child_item));
+	CHECK(onscreen_child_item->material_owner == nullptr);
+	CHECK_MESSAGE(offscreen_child_item->material_owner == root_item, "The offscreen subtree should not be visited.");
+
+	// Skipped on later frames too, as long as nothing changed.
+	drawn = TestRendererCanvasCullAccessor::cull(root, clip_rect);
+	CHECK(drawn.size() == 1);
+	CHECK(offscreen_child_item->material_owner == root_item);
+
+	// Moving it onscreen invalidates the cached bounds.
+	RSG::canvas->canvas_item_set_transform(offscreen, Transform2D(0, Vector2(50, 50)));
+	drawn = TestRendererCanvasCullAccessor::cull(root, clip_rect);
+	CHECK(drawn.size() == 2);
+	CHECK(drawn.has(offscreen_child_item));
+	CHECK(offscreen_child_item->material_owner == nullptr);
+
+	RSG::canvas->free(offscreen_child);
+	RSG::canvas->free(offscreen);
+	RSG::canvas->free(onscreen_child);
+	RSG::canvas->free(onscreen);
+	RSG::canvas->free(root);
+}
+
+// Items of a y-sorted subtree, in the order they are collected from the tree.
+static LocalVector<RendererCanvasCull::Item *> create_ysort_items(uint32_t p_count, uint64_t p_seed) {
+	RandomPCG rng(p_seed);
+	LocalVector<RendererCanvasCull::Item *> items;
+	for (uint32_t i = 0; i < p_count; i++) {
+		RendererCanvasCull::Item *item = memnew(RendererCanvasCull::Item);
+		item->ysort_index = i;
+		// Coarse positions, so some items share the same y and are ordered by index.
+		item->ysort_xform.columns[2].y = rng.random(0, 32);
+		items.push_back(item);
+	}
+	return items;
+}
+
+static bool is_same_order(const LocalVector<RendererCanvasCull::Item *> &p_a, const LocalVector<RendererCanvasCull::Item *> &p_b) {
+	if (p_a.size() != p_b.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < p_a.size(); i++) {
+		if (p_a[i] != p_b[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static LocalVector<RendererCanvasCull::Item *> full_ysort(const LocalVector<RendererCanvasCull::Item *> &p_items) {
+	LocalVector<RendererCanvasCull::Item *> sorted = p_items;
+	SortArray<RendererCanvasCull::Item *, RendererCanvasCull::ItemYSort> sorter;
+	sorter.sort(sorted.ptr(), sorted.size());
+	return sorted;
+}
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Y-sorting from the previous order matches a full sort") {
+	LocalVector<RendererCanvasCull::Item *> items = create_ysort_items(200, 4321);
+	LocalVector<RendererCanvasCull::Item *> previous = full_ysort(items);
+
+	SUBCASE("Few items moved") {
+		for (int frame = 0; frame < 8; frame++) {
+			for (uint32_t i = frame; i < items.size(); i += 50) {
+				items[i]->ysort_xform.columns[2].y += frame % 2 ? -1 : 1;
+			}
+
+			LocalVector<RendererCanvasCull::Item *> collected = items;
+			REQUIRE(TestRendererCanvasCullAccessor::ysort_from_previous_order(previous, collected.ptr(), collected.size()));
+			CHECK(is_same_order(collected, full_ysort(items)));
+			CHECK(is_same_order(previous, collected));
+		}
+	}
+
+	SUBCASE("Too many items moved") {
+		for (RendererCanvasCull::Item *item : items) {
+			item->ysort_xform.columns[2].y = -item->ysort_xform.columns[2].y;
+		}
+
+		LocalVector<RendererCanvasCull::Item *> collected = items;
+		CHECK_FALSE(TestRendererCanvasCullAccessor::ysort_from_previous_order(previous, collected.ptr(), collected.size()));
+		CHECK_MESSAGE(is_same_order(collected, items), "The items should be left for the full sort.");
+
+		// The previous order is partially sorted, but still holds the same items.
+		LocalVector<RendererCanvasCull::Item *> previous_items = previous;
+		previous_items.sort();
+		LocalVector<RendererCanvasCull::Item *> sorted_items = items;
+		sorted_items.sort();
+		CHECK(is_same_order(previous_items, sorted_items));
+	}
+
+	SUBCASE("Items were added") {
+		items.push_back(memnew(RendererCanvasCull::Item));
+		items[items.size() - 1]->ysort_index = items.size() - 1;
+
+		LocalVector<RendererCanvasCull::Item *> collected = items;
+		CHECK_FALSE(TestRendererCanvasCullAccessor::ysort_from_previous_order(previous, collected.ptr(), collected.size()));
+		CHECK(is_same_order(collected, items));
+	}
+
+	for (RendererCanvasCull::Item *item : items) {
+		memdelete(item);
+	}
+}
+
+} // namespace TestRendererCanvasCull
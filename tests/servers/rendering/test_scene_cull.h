@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  test_scene_cull.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/projection.h"
+#include "core/math/random_pcg.h"
+#include "servers/rendering/renderer_scene_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSceneCull {
+
+static RendererSceneCull::Frustum make_camera_frustum(const Vector3 &p_position, real_t p_yaw) {
+	Projection projection;
+	projection.set_perspective(75, 16.0 / 9.0, 0.05, 200);
+	Transform3D transform;
+	transform.basis = Basis(Vector3(0, 1, 0), p_yaw);
+	transform.origin = p_position;
+	return RendererSceneCull::Frustum(projection.get_projection_planes(transform));
+}
+
+static LocalVector<RendererSceneCull::InstanceBounds> make_random_bounds(uint32_t p_count, uint64_t p_seed) {
+	RandomPCG rng(p_seed);
+	LocalVector<RendererSceneCull::InstanceBounds> bounds;
+	bounds.reserve(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		Vector3 position(rng.random(-300.0, 300.0), rng.random(-50.0, 50.0), rng.random(-300.0, 300.0));
+		Vector3 size(rng.random(0.1, 20.0), rng.random(0.1, 20.0), rng.random(0.1, 20.0));
+		bounds.push_back(RendererSceneCull::InstanceBounds(AABB(position, size)));
+	}
+	return bounds;
+}
+
+TEST_CASE("[SceneCull] Frustum test with a plane hint matches the full test") {
+	LocalVector<RendererSceneCull::InstanceBounds> bounds = make_random_bounds(2000, 1234);
+
+	LocalVector<uint32_t> hints;
+	hints.resize(bounds.size());
+	for (uint32_t &hint : hints) {
+		hint = 0;
+	}
+
+	// The camera turns and moves, so hints left by the previous frame are sometimes stale.
+	for (int frame = 0; frame < 16; frame++) {
+		RendererSceneCull::Frustum frustum = make_camera_frustum(Vector3(frame * 4.0, 0, 0), frame * 0.3);
+		bool all_match = true;
+		for (uint32_t i = 0; i < bounds.size(); i++) {
+			const bool expected = bounds[i].in_frustum(frustum);
+			const bool result = bounds[i].in_frustum(frustum, hints[i]);
+			if (result != expected || (result && hints[i] != 0) || (!result && hints[i] == 0)) {
+				all_match = false;
+			}
+		}
+		CHECK_MESSAGE(all_match, vformat("Frame %d should give the same results with and without plane hints.", frame));
+	}
+}
+
+TEST_CASE("[SceneCull] Batched frustum test matches the per-instance test") {
+	const uint32_t batch_size = RendererSceneCull::InstanceBounds::FRUSTUM_BATCH_SIZE;
+	LocalVector<RendererSceneCull::InstanceBounds> bounds = make_random_bounds(batch_size * 10 + 7, 42);
+	RendererSceneCull::Frustum frustums[2] = {
+		make_camera_frustum(Vector3(), 0.0),
+		make_camera_frustum(Vector3(10, 20, 30), 2.0),
+	};
+
+	uint32_t masks[RendererSceneCull::InstanceBounds::FRUSTUM_BATCH_SIZE];
+	bool all_match = true;
+	for (uint32_t from = 0; from < bounds.size(); from += batch_size) {
+		const uint32_t count = MIN(batch_size, bounds.size() - from);
+		memset(masks, 0, sizeof(masks));
+		RendererSceneCull::InstanceBounds::in_frustum_batch(&bounds[from], count, frustums[0], 1, masks);
+		RendererSceneCull::InstanceBounds::in_frustum_batch(&bounds[from], count, frustums[1], 4, masks);
+		for (uint32_t i = 0; i < count; i++) {
+			const uint32_t expected = (bounds[from + i].in_frustum(frustums[0]) ? 1 : 0) | (bounds[from + i].in_frustum(frustums[1]) ? 4 : 0);
+			if (masks[i] != expected) {
+				all_match = false;
+			}
+		}
+	}
+	CHECK_MESSAGE(all_match, "Batched and per-instance frustum tests should agree on every instance.");
+}
+
+} // namespace TestSceneCull
@@ -85,6 +85,7 @@
 #include "tests/core/math/test_vector3i.h"
 #include "tests/core/math/test_vector4.h"
 #include "tests/core/math/test_vector4i.h"
+#include "tests/core/object/test_call_queue.h"
 #include "tests/core/object/test_class_db.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
@@ -134,8 +135,10 @@
 #include "tests/scene/test_image_texture.h"
 #include "tests/scene/test_image_texture_3d.h"
 #include "tests/scene/test_instance_placeholder.h"
+#include "tests/scene/test_multimesh.h"
 #include "tests/scene/test_node.h"
 #include "tests/scene/test_node_2d.h"
+#include "tests/scene/test_node_pool.h"
 #include "tests/scene/test_packed_scene.h"
 #include "tests/scene/test_parallax_2d.h"
 #include "tests/scene/test_path_2d.h"
@@ -149,6 +152,11 @@
 #include "tests/scene/test_viewport.h"
 #include "tests/scene/test_visual_shader.h"
 #include "tests/scene/test_window.h"
+#include "tests/servers/rendering/test_occlusion_cull_raster.h"
+#include "tests/servers/rendering/test_pipeline_hash_map_rd.h"
+#include "tests/servers/rendering/test_render_list_radix_sort.h"
+#include "tests/servers/rendering/test_renderer_canvas_cull.h"
+#include "tests/servers/rendering/test_scene_cull.h"
 #include "tests/servers/rendering/test_shader_preprocessor.h"
 #include "tests/servers/test_nav_heap.h"
 #include "tests/servers/test_text_server.h"
@@ -173,6 +181,7 @@
 #include "tests/scene/test_convert_transform_modifier_3d.h"
 #include "tests/scene/test_copy_transform_modifier_3d.h"
 #include "tests/scene/test_gltf_document.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_path_follow_3d.h"
 #include "tests/scene/test_primitives.h"